@@ -0,0 +1,209 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Camera/ProceduralCameraShake.h"
+
+namespace ProceduralShakeConstants
+{
+    /** ノイズの格子点の数（テーブルはこの周期で繰り返す） */
+    constexpr int32 LatticeSize = 64;
+
+    /** 格子1マスあたりのテーブルのサンプル数 */
+    constexpr int32 SamplesPerCell = 16;
+
+    constexpr int32 TableSize = LatticeSize * SamplesPerCell;
+
+    /** 各チャンネル（位置XYZ・回転PYR）が同じ揺れにならないよう、テーブル上でずらす量（格子単位） */
+    constexpr float ChannelStride = 10.37f;
+
+    /** シェイクごとの開始位置のずらし量（格子単位） */
+    constexpr float InstanceStride = 7.31f;
+
+    constexpr int32 NoiseSeed = 0x5EED;
+}
+
+namespace
+{
+    /**
+     * @brief 格子点の乱数を滑らかに補間したノイズテーブル（初回使用時に一度だけ構築）
+     */
+    struct FShakeNoiseTable
+    {
+        float Samples[ProceduralShakeConstants::TableSize];
+
+        FShakeNoiseTable()
+        {
+            using namespace ProceduralShakeConstants;
+
+            FRandomStream Stream(NoiseSeed);
+            float Lattice[LatticeSize];
+            for (float& Value : Lattice)
+            {
+                Value = Stream.FRandRange(-1.0f, 1.0f);
+            }
+
+            for (int32 Index = 0; Index < TableSize; ++Index)
+            {
+                const int32 Cell = Index / SamplesPerCell;
+                const float T = static_cast<float>(Index % SamplesPerCell) / SamplesPerCell;
+                const float A = Lattice[Cell];
+                const float B = Lattice[(Cell + 1) % LatticeSize];
+                Samples[Index] = FMath::Lerp(A, B, FMath::SmoothStep(0.0f, 1.0f, T));
+            }
+        }
+    };
+
+    const FShakeNoiseTable& GetNoiseTable()
+    {
+        static const FShakeNoiseTable Table;
+        return Table;
+    }
+}
+
+// 処理の流れ:
+// 1. 空きスロットを探す
+// 2. 空きがなければ残り時間が最も短いシェイクを置き換える
+// 3. パラメータとノイズの開始位置を設定
+void FProceduralCameraShakePool::Play(const FProceduralShakeParams& Params, float Scale)
+{
+    FProceduralShakeInstance* Target = nullptr;
+    float ShortestRemaining = TNumericLimits<float>::Max();
+
+    for (FProceduralShakeInstance& Instance : Instances)
+    {
+        if (!Instance.bActive)
+        {
+            Target = &Instance;
+            break;
+        }
+
+        const float Remaining = Instance.Params.Duration - Instance.Elapsed;
+        if (Remaining < ShortestRemaining)
+        {
+            ShortestRemaining = Remaining;
+            Target = &Instance;
+        }
+    }
+
+    Target->Params = Params;
+    Target->Scale = Scale;
+    Target->Elapsed = 0.0f;
+    Target->NoiseOffset = FMath::Fmod(NextNoiseSeed++ * ProceduralShakeConstants::InstanceStride,
+        static_cast<float>(ProceduralShakeConstants::LatticeSize));
+    Target->bActive = true;
+}
+
+void FProceduralCameraShakePool::StopAll(bool bImmediately)
+{
+    for (FProceduralShakeInstance& Instance : Instances)
+    {
+        if (!Instance.bActive)
+        {
+            continue;
+        }
+
+        if (bImmediately)
+        {
+            Instance.bActive = false;
+        }
+        else
+        {
+            // ブレンドアウト区間へ進める
+            Instance.Elapsed = FMath::Max(Instance.Elapsed, Instance.Params.Duration - Instance.Params.BlendOutTime);
+        }
+    }
+}
+
+// 処理の流れ:
+// 1. 再生中のシェイクの経過時間を進め、終わったものは解放
+// 2. ブレンド・減衰から強さを求める
+// 3. チャンネルごとにずらした位置でノイズを引き、振幅を掛けて合計
+// 4. 最初の1周期は符号付きのインパルスを半周期の山として加える
+bool FProceduralCameraShakePool::Evaluate(float DeltaTime, FVector& OutLocation, FRotator& OutRotation)
+{
+    using namespace ProceduralShakeConstants;
+
+    OutLocation = FVector::ZeroVector;
+    OutRotation = FRotator::ZeroRotator;
+    bool bAnyActive = false;
+
+    for (FProceduralShakeInstance& Instance : Instances)
+    {
+        if (!Instance.bActive)
+        {
+            continue;
+        }
+
+        Instance.Elapsed += DeltaTime;
+        if (Instance.Elapsed >= Instance.Params.Duration)
+        {
+            Instance.bActive = false;
+            continue;
+        }
+
+        const FProceduralShakeParams& Params = Instance.Params;
+        const float Strength = CalculateEnvelope(Instance) * Instance.Scale;
+
+        // 1周期 = 格子2マス分
+        const float Position = Instance.NoiseOffset + Instance.Elapsed * Params.Frequency * 2.0f;
+
+        OutLocation.X += SampleNoise(Position) * Params.LocationAmplitude.X * Strength;
+        OutLocation.Y += SampleNoise(Position + ChannelStride) * Params.LocationAmplitude.Y * Strength;
+        OutLocation.Z += SampleNoise(Position + ChannelStride * 2.0f) * Params.LocationAmplitude.Z * Strength;
+        OutRotation.Pitch += SampleNoise(Position + ChannelStride * 3.0f) * Params.RotationAmplitude.Pitch * Strength;
+        OutRotation.Yaw += SampleNoise(Position + ChannelStride * 4.0f) * Params.RotationAmplitude.Yaw * Strength;
+        OutRotation.Roll += SampleNoise(Position + ChannelStride * 5.0f) * Params.RotationAmplitude.Roll * Strength;
+
+        const float Cycle = Instance.Elapsed * Params.Frequency;
+        if (Cycle < 1.0f)
+        {
+            const float Impulse = FMath::Sin(UE_PI * Cycle) * Strength;
+            OutLocation += Params.LocationImpulse * Impulse;
+            OutRotation += Params.RotationImpulse * Impulse;
+        }
+
+        bAnyActive = true;
+    }
+
+    return bAnyActive;
+}
+
+// 処理の流れ:
+// 1. ブレンドイン・ブレンドアウトの小さい方を取る
+// 2. 経過に応じた減衰を掛ける
+float FProceduralCameraShakePool::CalculateEnvelope(const FProceduralShakeInstance& Instance)
+{
+    const FProceduralShakeParams& Params = Instance.Params;
+
+    float Envelope = 1.0f;
+    if (Params.BlendInTime > 0.0f)
+    {
+        Envelope = FMath::Min(Envelope, Instance.Elapsed / Params.BlendInTime);
+    }
+    if (Params.BlendOutTime > 0.0f)
+    {
+        Envelope = FMath::Min(Envelope, (Params.Duration - Instance.Elapsed) / Params.BlendOutTime);
+    }
+
+    const float Alpha = FMath::Clamp(Instance.Elapsed / Params.Duration, 0.0f, 1.0f);
+    Envelope *= FMath::Pow(1.0f - Alpha, Params.Falloff);
+
+    return FMath::Clamp(Envelope, 0.0f, 1.0f);
+}
+
+float FProceduralCameraShakePool::SampleNoise(float Position)
+{
+    using namespace ProceduralShakeConstants;
+
+    const float* Samples = GetNoiseTable().Samples;
+
+    float TablePosition = FMath::Fmod(Position * SamplesPerCell, static_cast<float>(TableSize));
+    if (TablePosition < 0.0f)
+    {
+        TablePosition += TableSize;
+    }
+
+    const int32 Index0 = FMath::Min(FMath::FloorToInt32(TablePosition), TableSize - 1);
+    const int32 Index1 = (Index0 + 1) % TableSize;
+    return FMath::Lerp(Samples[Index0], Samples[Index1], TablePosition - Index0);
+}
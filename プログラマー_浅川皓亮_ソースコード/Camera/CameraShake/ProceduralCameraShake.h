@@ -0,0 +1,112 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProceduralCameraShake.generated.h"
+
+/**
+ * @brief プロシージャルシェイクのパラメータ（データとして保持する）
+ */
+USTRUCT(BlueprintType)
+struct FProceduralShakeParams
+{
+    GENERATED_BODY()
+
+    /** 持続時間（秒） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shake", meta = (ClampMin = "0.01"))
+    float Duration = 0.3f;
+
+    /** ブレンドイン時間（秒） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shake", meta = (ClampMin = "0.0"))
+    float BlendInTime = 0.02f;
+
+    /** ブレンドアウト時間（秒） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shake", meta = (ClampMin = "0.0"))
+    float BlendOutTime = 0.1f;
+
+    /** 位置の振幅（カメラローカル） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shake")
+    FVector LocationAmplitude = FVector::ZeroVector;
+
+    /** 回転の振幅（度） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shake")
+    FRotator RotationAmplitude = FRotator::ZeroRotator;
+
+    /** 周波数（Hz） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shake", meta = (ClampMin = "0.1"))
+    float Frequency = 10.0f;
+
+    /** 経過に応じた減衰の強さ（0: 減衰なし、大きいほど序盤に集中） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shake", meta = (ClampMin = "0.0"))
+    float Falloff = 1.0f;
+
+    /** 最初の1周期だけ加える符号付きの位置オフセット（半周期の山で加わって戻る。ノイズと違い向きが毎回同じ） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shake")
+    FVector LocationImpulse = FVector::ZeroVector;
+
+    /** 最初の1周期だけ加える符号付きの回転オフセット（度） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shake")
+    FRotator RotationImpulse = FRotator::ZeroRotator;
+};
+
+/**
+ * @brief 再生中のシェイク1つ分
+ */
+struct FProceduralShakeInstance
+{
+    FProceduralShakeParams Params;
+    float Scale = 1.0f;
+    float Elapsed = 0.0f;
+
+    /** ノイズテーブル上の開始位置（シェイクごとに変えて同じ揺れにならないようにする） */
+    float NoiseOffset = 0.0f;
+
+    bool bActive = false;
+};
+
+/**
+ * @brief 事前確保したプールと事前計算したノイズテーブルで評価するカメラシェイク
+ * @details 再生のたびにオブジェクトを生成しない。プールが埋まっている場合は残り時間が最も短いものを置き換える。
+ */
+class CARRY_API FProceduralCameraShakePool
+{
+public:
+    /** 同時に再生できるシェイク数 */
+    static constexpr int32 MaxInstances = 8;
+
+    /**
+     * @brief シェイクを再生
+     * @param Params シェイクのパラメータ
+     * @param Scale 振幅の倍率
+     */
+    void Play(const FProceduralShakeParams& Params, float Scale = 1.0f);
+
+    /**
+     * @brief すべてのシェイクを停止
+     * @param bImmediately true: 即座に停止、false: ブレンドアウトして停止
+     */
+    void StopAll(bool bImmediately);
+
+    /**
+     * @brief 全シェイクを進めて合計の揺れを求める
+     * @param DeltaTime フレーム時間
+     * @param OutLocation 位置オフセット（カメラローカル）
+     * @param OutRotation 回転オフセット
+     * @return 再生中のシェイクがあった場合 true
+     */
+    bool Evaluate(float DeltaTime, FVector& OutLocation, FRotator& OutRotation);
+
+private:
+    /** @brief 経過時間からブレンド・減衰を掛けた強さを求める */
+    static float CalculateEnvelope(const FProceduralShakeInstance& Instance);
+
+    /** @brief ノイズテーブルを線形補間で引く（-1〜1） */
+    static float SampleNoise(float Position);
+
+private:
+    FProceduralShakeInstance Instances[MaxInstances];
+
+    /** @brief 次のシェイクのノイズ開始位置 */
+    uint32 NextNoiseSeed = 0;
+};
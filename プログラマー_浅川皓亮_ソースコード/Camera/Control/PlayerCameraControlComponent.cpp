@@ -6,6 +6,8 @@
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/Controller.h"
+#include "Camera/LayeredCameraManager.h"
+#include "Shakes/LegacyCameraShake.h"
 
 #include "SaveManager.h"
 
@@ -15,12 +17,59 @@ namespace CameraControlConstants
     constexpr float DefaultRoll = 0.0f;
 }
 
+#if WITH_EDITORONLY_DATA
+namespace
+{
+    // 処理の流れ:
+    // 1. ULegacyCameraShake でなければ移し替えない
+    // 2. 持続時間・ブレンド時間・各チャンネルの振幅をコピー
+    // 3. 周波数は振幅のあるチャンネルの最大値を使う
+    bool ConvertLegacyShake(TSubclassOf<UCameraShakeBase> ShakeClass, FProceduralShakeParams& OutParams)
+    {
+        const ULegacyCameraShake* Legacy = ShakeClass ? Cast<ULegacyCameraShake>(ShakeClass->GetDefaultObject()) : nullptr;
+        if (!Legacy)
+        {
+            return false;
+        }
+
+        OutParams.Duration = FMath::Max(Legacy->OscillationDuration, 0.01f);
+        OutParams.BlendInTime = Legacy->OscillationBlendInTime;
+        OutParams.BlendOutTime = Legacy->OscillationBlendOutTime;
+        OutParams.LocationAmplitude = FVector(
+            Legacy->LocOscillation.X.Amplitude,
+            Legacy->LocOscillation.Y.Amplitude,
+            Legacy->LocOscillation.Z.Amplitude);
+        OutParams.RotationAmplitude = FRotator(
+            Legacy->RotOscillation.Pitch.Amplitude,
+            Legacy->RotOscillation.Yaw.Amplitude,
+            Legacy->RotOscillation.Roll.Amplitude);
+
+        float Frequency = 0.0f;
+        for (const FFOscillator* Oscillator : { &Legacy->LocOscillation.X, &Legacy->LocOscillation.Y, &Legacy->LocOscillation.Z,
+            &Legacy->RotOscillation.Pitch, &Legacy->RotOscillation.Yaw, &Legacy->RotOscillation.Roll })
+        {
+            if (Oscillator->Amplitude != 0.0f)
+            {
+                Frequency = FMath::Max(Frequency, Oscillator->Frequency);
+            }
+        }
+        if (Frequency > 0.0f)
+        {
+            OutParams.Frequency = Frequency;
+        }
+
+        return true;
+    }
+}
+#endif
+
 // 処理の流れ:
 // 1. メンバ変数を初期化
-// 2. Tickを有効化
-// 3. カメラコンポーネントを作成
-// 4. カメラをこのコンポーネントにアタッチ
-// 5. PawnControlRotationを設定
+// 2. Tickは適用先を決めるまでと、直接適用（フォールバック）のために有効にしておく
+// 3. プリセットシェイクの既定値を設定
+// 4. カメラコンポーネントを作成
+// 5. カメラをこのコンポーネントにアタッチ
+// 6. PawnControlRotationを設定
 UPlayerCameraControlComponent::UPlayerCameraControlComponent()
     : bUsePawnControlRotation(true)
     , Camera(nullptr)
@@ -33,6 +82,24 @@ UPlayerCameraControlComponent::UPlayerCameraControlComponent()
     , TargetFOV(90.0f)
 {
     PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = true;
+
+    LightShake.Duration = 0.2f;
+    LightShake.LocationAmplitude = FVector(0.0f, 0.0f, 2.0f);
+    LightShake.RotationAmplitude = FRotator(1.0f, 0.5f, 0.25f);
+
+    MediumShake.Duration = 0.35f;
+    MediumShake.LocationAmplitude = FVector(0.0f, 0.0f, 5.0f);
+    MediumShake.RotationAmplitude = FRotator(3.0f, 1.5f, 0.75f);
+
+    HeavyShake.Duration = 0.2f;
+    HeavyShake.BlendInTime = 0.02f;
+    HeavyShake.BlendOutTime = 0.1f;
+    HeavyShake.LocationAmplitude = FVector(0.0f, 0.0f, 3.0f);
+    HeavyShake.RotationAmplitude = FRotator(2.0f, 0.0f, 0.5f);
+    HeavyShake.LocationImpulse = FVector(0.0f, 0.0f, -12.0f);
+    HeavyShake.RotationImpulse = FRotator(-8.0f, 0.0f, 0.0f);
+    HeavyShake.Frequency = 6.0f;
 
     Camera = CreateDefaultSubobject<UCameraComponent>(TEXT("PlayerCamera"));
     if (Camera)
@@ -65,14 +132,129 @@ void UPlayerCameraControlComponent::BeginPlay()
 }
 
 // 処理の流れ:
-// 1. カメラのロールを更新
-// 2. FOVを更新
+// 1. 旧プリセットのシェイククラスが設定されていればパラメータに移し替える
+// 2. 移し替えたクラスはクリアする（次の保存で消える）
+void UPlayerCameraControlComponent::PostLoad()
+{
+    Super::PostLoad();
+
+#if WITH_EDITORONLY_DATA
+    const TPair<TSubclassOf<UCameraShakeBase>*, FProceduralShakeParams*> Presets[] = {
+        { &LightShakeClass_DEPRECATED, &LightShake },
+        { &MediumShakeClass_DEPRECATED, &MediumShake },
+        { &HeavyShakeClass_DEPRECATED, &HeavyShake },
+    };
+
+    for (const TPair<TSubclassOf<UCameraShakeBase>*, FProceduralShakeParams*>& Preset : Presets)
+    {
+        if (!*Preset.Key)
+        {
+            continue;
+        }
+
+        if (!ConvertLegacyShake(*Preset.Key, *Preset.Value))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("PlayerCameraControl: %s is not a legacy camera shake, preset kept as is"),
+                *(*Preset.Key)->GetName());
+        }
+        *Preset.Key = nullptr;
+    }
+#endif
+}
+
+// 処理の流れ:
+// 1. 直接適用に決まっていれば、キャッシュしたコントローラーでカメラを更新
+//    （コントローラーが外れたら適用先を決め直す）
+// 2. 未決定なら、コントローラーとカメラマネージャーが揃うまで待つ
+// 3. 揃ったら一度だけ適用先を決める
+//    - レイヤー式のカメラマネージャーならTickを止める（以降はマネージャーから更新）
+//    - 別クラスならエラーを出して直接適用に切り替える
 void UPlayerCameraControlComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+    if (CameraApplyMode == ECameraApplyMode::Direct)
+    {
+        if (APlayerController* PC = DirectController.Get())
+        {
+            ApplyCameraDirectly(DeltaTime, *PC);
+            return;
+        }
+
+        CameraApplyMode = ECameraApplyMode::Undecided;
+    }
+
+    APlayerController* PC = GetOwner() ? Cast<APlayerController>(GetOwner()->GetInstigatorController()) : nullptr;
+    if (!PC || !PC->PlayerCameraManager)
+    {
+        return;
+    }
+
+    if (PC->PlayerCameraManager->IsA<ALayeredCameraManager>())
+    {
+        CameraApplyMode = ECameraApplyMode::Layered;
+        SetComponentTickEnabled(false);
+        return;
+    }
+
+    UE_LOG(LogTemp, Error, TEXT("PlayerCameraControl: PlayerCameraManagerClass is %s, not ALayeredCameraManager. Roll/FOV/HeadBob/Shake are applied to the camera directly."),
+        *PC->PlayerCameraManager->GetClass()->GetName());
+
+    CameraApplyMode = ECameraApplyMode::Direct;
+    DirectController = PC;
+    ApplyCameraDirectly(DeltaTime, *PC);
+}
+
+// 処理の流れ:
+// 1. ロール・FOV・ヘッドボブを補間
+// 2. ロールはコントロール回転、FOVとヘッドボブはカメラコンポーネントに直接設定
+// 3. このコンポーネントのプールでシェイクを評価し、カメラの加算オフセット（カメラローカル）に設定
+void UPlayerCameraControlComponent::ApplyCameraDirectly(float DeltaTime, APlayerController& PlayerController)
+{
+    UpdateCameraRoll(DeltaTime);
+    UpdateFOV(DeltaTime);
+    UpdateHeadBobOffset(DeltaTime);
+
+    FRotator ControlRotation = PlayerController.GetControlRotation();
+    ControlRotation.Roll = CurrentRoll;
+    PlayerController.SetControlRotation(ControlRotation);
+
+    if (Camera)
+    {
+        Camera->SetFieldOfView(CurrentFOV);
+        Camera->SetRelativeLocation(CameraLocationOffset + FVector(0.0f, 0.0f, HeadBobOffset));
+
+        FVector ShakeLocation;
+        FRotator ShakeRotation;
+        Camera->ClearAdditiveOffset();
+        if (DirectShakePool.Evaluate(DeltaTime, ShakeLocation, ShakeRotation))
+        {
+            Camera->AddAdditiveOffset(FTransform(ShakeRotation, ShakeLocation), 0.0f);
+        }
+    }
+}
+
+// 処理の流れ:
+// 1. ロール・FOV・ヘッドボブを補間
+// 2. ロールは回転オフセット、FOVはデフォルトとの差分として加算レイヤーに書き込む
+// 3. ヘッドボブはこのコンポーネントの上方向へのオフセットとして書き込む
+void UPlayerCameraControlComponent::UpdateCameraLayers(float DeltaTime, ALayeredCameraManager& CameraManager)
+{
     UpdateCameraRoll(DeltaTime);
     UpdateFOV(DeltaTime);
+    UpdateHeadBobOffset(DeltaTime);
+
+    FCameraLayerValue RollLayer;
+    RollLayer.Rotation.Roll = CurrentRoll;
+    CameraManager.SetLayer(ECameraLayer::Roll, RollLayer);
+
+    FCameraLayerValue FOVLayer;
+    FOVLayer.FOV = CurrentFOV - FOVSettings.DefaultFOV;
+    CameraManager.SetLayer(ECameraLayer::FOV, FOVLayer);
+
+    FCameraLayerValue HeadBobLayer;
+    HeadBobLayer.LocationOffset = GetUpVector() * HeadBobOffset;
+    CameraManager.SetLayer(ECameraLayer::HeadBob, HeadBobLayer);
 }
 
 // 処理の流れ:
@@ -168,23 +350,10 @@ void UPlayerCameraControlComponent::SetPitchInverted(bool bInverted)
 }
 
 // 処理の流れ:
-// 1. カメラの有効性確認
-// 2. 現在のロールをターゲットに向けて補間
-// 3. PlayerControllerのControlRotationに直接Rollを設定
+// 1. 現在のロールをターゲットに向けて補間（適用はカメラマネージャーのロールレイヤー）
 void UPlayerCameraControlComponent::UpdateCameraRoll(float DeltaTime)
 {
-    if (!Camera)
-        return;
-
     CurrentRoll = FMath::FInterpTo(CurrentRoll, TargetRoll, DeltaTime, RotationSettings.RollInterpSpeed);
-
-    APlayerController* PC = Cast<APlayerController>(GetOwner()->GetInstigatorController());
-    if (PC)
-    {
-        FRotator ControlRotation = PC->GetControlRotation();
-        ControlRotation.Roll = CurrentRoll;
-        PC->SetControlRotation(ControlRotation);
-    }
 }
 
 // 処理の流れ:
@@ -229,44 +398,41 @@ FVector UPlayerCameraControlComponent::GetCameraOffset() const
 }
 
 // 処理の流れ:
-// 1. ヘッドボブが有効か、カメラが存在するか確認
-// 2. 停止中またはジャンプ中はヘッドボブをリセット
-// 3. 移動速度に応じたボブ強度を計算
-// 4. ボブオフセットを計算
-// 5. ソケット基準の相対位置にボブを適用
+// 1. ヘッドボブが有効か確認
+// 2. 停止中またはジャンプ中かを記録
+// 3. 移動速度に応じたボブ強度を記録
+// ※ オフセットの計算と適用はカメラマネージャーの更新時に行う
 void UPlayerCameraControlComponent::UpdateHeadBob(const FVector2D& MoveInput, bool IsMoving, bool IsFalling)
 {
-    if (!HeadBobSettings.bEnabled || !Camera)
+    if (!HeadBobSettings.bEnabled)
         return;
 
-    if (!IsMoving || IsFalling || MoveInput.IsNearlyZero(CameraControlConstants::InputDeadZone))
-    {
-        FVector CurrentRelativeLocation = Camera->GetRelativeLocation();
-        FVector TargetRelativeLocation = CameraLocationOffset;
-        FVector NewRelativeLocation = FMath::VInterpTo(
-            CurrentRelativeLocation,
-            TargetRelativeLocation,
-            GetWorld()->GetDeltaSeconds(),
-            HeadBobSettings.InterpSpeed
-        );
-        Camera->SetRelativeLocation(NewRelativeLocation);
-        HeadBobTime = 0.0f;
-        return;
-    }
+    LastHeadBobInputFrame = GFrameCounter;
+    bHeadBobMoving = IsMoving && !IsFalling && !MoveInput.IsNearlyZero(CameraControlConstants::InputDeadZone);
 
-    float SpeedFactor = 1.0f;
+    HeadBobSpeedFactor = 1.0f;
     if (GetOwner())
     {
         float CurrentSpeed = GetOwner()->GetVelocity().Size();
-        SpeedFactor = FMath::Clamp(CurrentSpeed / HeadBobSettings.SpeedReference, 0.0f, 1.0f);
+        HeadBobSpeedFactor = FMath::Clamp(CurrentSpeed / HeadBobSettings.SpeedReference, 0.0f, 1.0f);
     }
+}
 
-    float BobOffset = CalculateHeadBobOffset(GetWorld()->GetDeltaSeconds(), SpeedFactor);
+// 処理の流れ:
+// 1. このフレームか前フレームに移動入力があり、移動中ならボブを進める
+// 2. 入力が途切れた・停止中・ジャンプ中なら0へ補間してタイマーをリセット
+void UPlayerCameraControlComponent::UpdateHeadBobOffset(float DeltaTime)
+{
+    const bool bInputRecent = GFrameCounter - LastHeadBobInputFrame <= 1;
 
-    FVector NewRelativeLocation = CameraLocationOffset;
-    NewRelativeLocation.Z += BobOffset;
+    if (HeadBobSettings.bEnabled && bHeadBobMoving && bInputRecent)
+    {
+        HeadBobOffset = CalculateHeadBobOffset(DeltaTime, HeadBobSpeedFactor);
+        return;
+    }
 
-    Camera->SetRelativeLocation(NewRelativeLocation);
+    HeadBobOffset = FMath::FInterpTo(HeadBobOffset, 0.0f, DeltaTime, HeadBobSettings.InterpSpeed);
+    HeadBobTime = 0.0f;
 }
 
 // 処理の流れ:
@@ -283,16 +449,13 @@ void UPlayerCameraControlComponent::SetHeadBobEnabled(bool bEnabled)
 }
 
 // 処理の流れ:
-// 1. カメラの有効性確認
-// 2. ヘッドボブタイマーをリセット
-// 3. カメラをソケット基準の位置に戻す
+// 1. ヘッドボブタイマーをリセット
+// 2. オフセットを0に戻す（次のカメラ更新で反映）
 void UPlayerCameraControlComponent::ResetHeadBob()
 {
-    if (!Camera)
-        return;
-
     HeadBobTime = 0.0f;
-    Camera->SetRelativeLocation(CameraLocationOffset);
+    HeadBobOffset = 0.0f;
+    bHeadBobMoving = false;
 }
 
 // 処理の流れ:
@@ -358,10 +521,31 @@ void UPlayerCameraControlComponent::PlayCameraShake(TSubclassOf<UCameraShakeBase
 }
 
 // 処理の流れ:
-// 1. PlayerControllerを取得
-// 2. 全てのカメラシェイクを停止
+// 1. レイヤー式のカメラマネージャーがあればそちらで再生
+// 2. なければこのコンポーネントのプールで再生（直接適用時にTickで評価）
+void UPlayerCameraControlComponent::PlayProceduralShake(const FProceduralShakeParams& Params, float Scale)
+{
+    if (ALayeredCameraManager* CameraManager = ALayeredCameraManager::FindForActor(GetOwner()))
+    {
+        CameraManager->PlayProceduralShake(Params, Scale);
+        return;
+    }
+
+    DirectShakePool.Play(Params, Scale);
+}
+
+// 処理の流れ:
+// 1. プロシージャルシェイクを停止（カメラマネージャー・直接適用用の両方）
+// 2. PlayerControllerを取得
+// 3. 全てのカメラシェイクを停止
 void UPlayerCameraControlComponent::StopAllCameraShakes(bool bImmediately)
 {
+    if (ALayeredCameraManager* CameraManager = ALayeredCameraManager::FindForActor(GetOwner()))
+    {
+        CameraManager->StopProceduralShakes(bImmediately);
+    }
+    DirectShakePool.StopAll(bImmediately);
+
     APlayerController* PC = Cast<APlayerController>(GetOwner()->GetInstigatorController());
     if (!PC)
     {
@@ -393,67 +577,45 @@ void UPlayerCameraControlComponent::StopCameraShake(TSubclassOf<UCameraShakeBase
 
 void UPlayerCameraControlComponent::PlayLightShake()
 {
-    if (LightShakeClass)
-    {
-        PlayCameraShake(LightShakeClass);
-    }
-    else
-    {
-        UE_LOG(LogTemp, Warning, TEXT("PlayerCameraControl: LightShakeClass not set"));
-    }
+    PlayProceduralShake(LightShake);
 }
 
 void UPlayerCameraControlComponent::PlayMediumShake()
 {
-    if (MediumShakeClass)
-    {
-        PlayCameraShake(MediumShakeClass);
-    }
-    else
-    {
-        UE_LOG(LogTemp, Warning, TEXT("PlayerCameraControl: MediumShakeClass not set"));
-    }
+    PlayProceduralShake(MediumShake);
 }
 
 void UPlayerCameraControlComponent::PlayHeavyShake()
 {
-    if (HeavyShakeClass)
-    {
-        PlayCameraShake(HeavyShakeClass);
-    }
-    else
-    {
-        UE_LOG(LogTemp, Warning, TEXT("PlayerCameraControl: HeavyShakeClass not set"));
-    }
+    PlayProceduralShake(HeavyShake);
 }
 
 // 処理の流れ:
-// 1. カスタムシェイクのパラメータをログ出力
-// 2. フォールバックとしてMediumShakeを使用
-// 3. Amplitudeをスケールに変換して再生
+// 1. 指定された持続時間・周波数でパラメータを組み立てる
+// 2. 振幅を各チャンネルに割り振る
+// 3. プロシージャルシェイクとして再生
 void UPlayerCameraControlComponent::PlayCustomShake(float Duration, float Amplitude, float Frequency)
 {
-    UE_LOG(LogTemp, Log, TEXT("PlayerCameraControl: Custom shake (Duration: %.2f, Amplitude: %.2f, Frequency: %.2f)"),
-        Duration, Amplitude, Frequency);
-
-    if (MediumShakeClass)
-    {
-        float Scale = Amplitude / 5.0f;
-        PlayCameraShake(MediumShakeClass, Scale);
-    }
+    FProceduralShakeParams Params;
+    Params.Duration = FMath::Max(Duration, 0.01f);
+    Params.Frequency = FMath::Max(Frequency, 0.1f);
+    Params.BlendOutTime = FMath::Min(Params.BlendOutTime, Params.Duration * 0.5f);
+    Params.LocationAmplitude = FVector(0.0f, 0.0f, Amplitude);
+    Params.RotationAmplitude = FRotator(Amplitude, Amplitude * 0.5f, Amplitude * 0.25f);
+
+    PlayProceduralShake(Params);
 }
 
 // 処理の流れ:
 // 1. ターゲットFOVを60〜120の範囲にクランプ
-// 2. 即座に適用する場合はCurrentFOVも更新してカメラに設定
+// 2. 即座に適用する場合はCurrentFOVも更新（次のカメラ更新で反映）
 void UPlayerCameraControlComponent::SetFOV(float NewFOV, bool bInstant)
 {
     TargetFOV = FMath::Clamp(NewFOV, 60.0f, 120.0f);
 
-    if (bInstant && Camera)
+    if (bInstant)
     {
         CurrentFOV = TargetFOV;
-        Camera->SetFieldOfView(CurrentFOV);
     }
 }
 
@@ -463,16 +625,10 @@ void UPlayerCameraControlComponent::ResetFOV(bool bInstant)
 }
 
 // 処理の流れ:
-// 1. カメラの有効性確認
-// 2. CurrentFOVをTargetFOVに向けて補間
-// 3. カメラにFOVを設定
+// 1. CurrentFOVをTargetFOVに向けて補間（適用はカメラマネージャーのFOVレイヤー）
 void UPlayerCameraControlComponent::UpdateFOV(float DeltaTime)
 {
-    if (!Camera)
-        return;
-
     CurrentFOV = FMath::FInterpTo(CurrentFOV, TargetFOV, DeltaTime, FOVSettings.InterpSpeed);
-    Camera->SetFieldOfView(CurrentFOV);
 }
 
 // 処理の流れ:
@@ -5,12 +5,25 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "InputActionValue.h"
+#include "Camera/ProceduralCameraShake.h"
 #include "PlayerCameraControlComponent.generated.h"
 
 
 // Forward declarations
 class UCameraComponent;
 class UCharacterMovementComponent;
+class ALayeredCameraManager;
+class APlayerController;
+
+/**
+ * @brief ロール・FOV・ヘッドボブ・シェイクの適用先
+ */
+enum class ECameraApplyMode : uint8
+{
+    Undecided,  // コントローラー待ち
+    Layered,    // ALayeredCameraManager のレイヤーに書き込む
+    Direct,     // カメラを直接動かす（フォールバック）
+};
 
 /**
  * @brief カメラの回転設定
@@ -90,6 +103,9 @@ struct FFOVSettings
  *          - 移動時のヘッドボブエフェクト
  *          - 動的なFOV変更（ブースト、壁走りなど）
  *          - カメラロール（傾き）制御
+ *          ロール・FOV・ヘッドボブはカメラを直接動かさず、ALayeredCameraManager のレイヤーとして毎フレーム1回書き込む
+ *          PlayerCameraManagerClass が ALayeredCameraManager でない場合はエラーを出し、カメラを直接動かす
+ *          （プロシージャルシェイクもこのコンポーネントのプールで評価する）
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class CARRY_API UPlayerCameraControlComponent : public USceneComponent
@@ -100,8 +116,25 @@ public:
     UPlayerCameraControlComponent();
 
     virtual void BeginPlay() override;
+
+    /** @brief 旧プリセットのシェイククラスが設定されていればパラメータに移し替える */
+    virtual void PostLoad() override;
+
+    /**
+     * @brief ALayeredCameraManager が見つからないときだけカメラを直接更新する
+     * @details コントローラーが付いた時点で一度だけ適用先を決める。
+     *          カメラマネージャーがあればTickを止め、以降はカメラマネージャーから更新される
+     */
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+    /**
+     * @brief ロール・FOV・ヘッドボブを補間し、カメラマネージャーのレイヤーに書き込む
+     * @details ALayeredCameraManager::UpdateViewTarget から1フレーム1回呼ばれる
+     * @param DeltaTime フレーム時間
+     * @param CameraManager 書き込み先のカメラマネージャー
+     */
+    void UpdateCameraLayers(float DeltaTime, ALayeredCameraManager& CameraManager);
+
     // ============================================
     // Camera Rotation
     // ============================================
@@ -211,6 +244,15 @@ public:
         ECameraShakePlaySpace PlaySpace = ECameraShakePlaySpace::CameraLocal,
         FRotator UserPlaySpaceRot = FRotator::ZeroRotator);
 
+    /**
+     * @brief プロシージャルシェイクを再生
+     * @details 事前確保したプールで評価するため、連続して再生してもオブジェクトを生成しない
+     * @param Params シェイクのパラメータ
+     * @param Scale 振幅の倍率
+     */
+    UFUNCTION(BlueprintCallable, Category = "Camera Control|Shake")
+    void PlayProceduralShake(const FProceduralShakeParams& Params, float Scale = 1.0f);
+
     /**
      * @brief すべてのカメラシェイクを停止
      * @param bImmediately true: 即座に停止、false: フェードアウト
@@ -246,6 +288,7 @@ public:
 
     /**
      * @brief カスタムカメラシェイク（パラメータ指定）
+     * @details ピッチにAmplitude、ヨーに半分、ロールに4分の1、上下位置にAmplitudeの振幅で揺らす
      * @param Duration シェイクの持続時間
      * @param Amplitude 振幅
      * @param Frequency 周波数
@@ -257,15 +300,28 @@ public:
     // Camera Shake Settings
     // ============================================
 
-    /** プリセットシェイクのクラス */
+    /** プリセットシェイクのパラメータ */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Control|Shake Settings")
-    TSubclassOf<UCameraShakeBase> LightShakeClass;
+    FProceduralShakeParams LightShake;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Control|Shake Settings")
-    TSubclassOf<UCameraShakeBase> MediumShakeClass;
+    FProceduralShakeParams MediumShake;
 
+    /** 強（着地時）: インパルスで縦にグッと沈み、視点が一瞬下に向く */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Control|Shake Settings")
-    TSubclassOf<UCameraShakeBase> HeavyShakeClass;
+    FProceduralShakeParams HeavyShake;
+
+#if WITH_EDITORONLY_DATA
+    /** 旧プリセットのシェイククラス（PostLoad でパラメータに移し替える） */
+    UPROPERTY()
+    TSubclassOf<UCameraShakeBase> LightShakeClass_DEPRECATED;
+
+    UPROPERTY()
+    TSubclassOf<UCameraShakeBase> MediumShakeClass_DEPRECATED;
+
+    UPROPERTY()
+    TSubclassOf<UCameraShakeBase> HeavyShakeClass_DEPRECATED;
+#endif
 
     /**
      * @brief カメラコンポーネントを取得
@@ -332,6 +388,9 @@ private:
     /** ヘッドボブのベース位置を取得 */
     FVector GetHeadBobBaseLocation() const;
 
+    /** 直近の移動入力からヘッドボブのオフセットを補間更新 */
+    void UpdateHeadBobOffset(float DeltaTime);
+
     // ============================================
     // FOV Internal
     // ============================================
@@ -341,6 +400,9 @@ private:
 
     void UpdateBaseCameraLocation();
 
+    /** レイヤー式のカメラマネージャーがないときにロール・FOV・ヘッドボブ・シェイクを直接適用 */
+    void ApplyCameraDirectly(float DeltaTime, APlayerController& PlayerController);
+
 private:
     // ============================================
     // Camera Component
@@ -384,6 +446,18 @@ private:
     /** ヘッドボブのベース位置（オフセット前） */
     FVector HeadBobBaseLocation;
 
+    /** 現在のヘッドボブのオフセット（上方向） */
+    float HeadBobOffset = 0.0f;
+
+    /** 直近の移動入力でボブすべきだったか */
+    bool bHeadBobMoving = false;
+
+    /** 直近の移動入力時の速度係数 */
+    float HeadBobSpeedFactor = 0.0f;
+
+    /** 最後に移動入力を受けたフレーム（入力が途切れたら停止扱い） */
+    uint64 LastHeadBobInputFrame = 0;
+
     // ============================================
     // FOV State
     // ============================================
@@ -397,6 +471,19 @@ private:
     /** カメラが頭にアタッチされているか（true: 頭の動きに追従、false: 揺れなし） */
     bool bIsCameraAttachedToHead = true;
 
+    // ============================================
+    // Direct Mode State
+    // ============================================
+
+    /** ロール・FOV・ヘッドボブ・シェイクの適用先 */
+    ECameraApplyMode CameraApplyMode = ECameraApplyMode::Undecided;
+
+    /** 直接適用するときのコントローラー（キャッシュ） */
+    TWeakObjectPtr<APlayerController> DirectController;
+
+    /** 直接適用するときのプロシージャルシェイク */
+    FProceduralCameraShakePool DirectShakePool;
+
     // ============================================
     // Settings
     // ============================================
@@ -0,0 +1,135 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Camera/LayeredCameraManager.h"
+#include "Component/PlayerCameraControlComponent.h"
+#include "GameFramework/PlayerController.h"
+
+DECLARE_CYCLE_STAT(TEXT("Camera Solve"), STAT_LayeredCameraSolve, STATGROUP_Game);
+
+ALayeredCameraManager::ALayeredCameraManager()
+{
+}
+
+ALayeredCameraManager* ALayeredCameraManager::FindForActor(const AActor* Actor)
+{
+    if (!Actor)
+    {
+        return nullptr;
+    }
+
+    const APlayerController* PC = Cast<APlayerController>(Actor->GetInstigatorController());
+    return PC ? Cast<ALayeredCameraManager>(PC->PlayerCameraManager) : nullptr;
+}
+
+void ALayeredCameraManager::SetLayer(ECameraLayer Layer, const FCameraLayerValue& Value)
+{
+    const int32 Index = static_cast<int32>(Layer);
+    Layers[Index] = Value;
+    bLayerActive[Index] = true;
+}
+
+void ALayeredCameraManager::ClearLayer(ECameraLayer Layer)
+{
+    bLayerActive[static_cast<int32>(Layer)] = false;
+}
+
+bool ALayeredCameraManager::IsLayerActive(ECameraLayer Layer) const
+{
+    return bLayerActive[static_cast<int32>(Layer)];
+}
+
+void ALayeredCameraManager::PlayProceduralShake(const FProceduralShakeParams& Params, float Scale)
+{
+    ShakePool.Play(Params, Scale);
+}
+
+void ALayeredCameraManager::StopProceduralShakes(bool bImmediately)
+{
+    ShakePool.StopAll(bImmediately);
+}
+
+// 処理の流れ:
+// 1. 基本のビュー（カメラコンポーネント）を計算
+// 2. カメラ制御コンポーネントにロール・FOV・ヘッドボブのレイヤーを更新させる
+// 3. シェイクプールからシェイクレイヤーを更新
+// 4. 全レイヤーを評価順に合成
+void ALayeredCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float DeltaTime)
+{
+    Super::UpdateViewTarget(OutVT, DeltaTime);
+
+    SCOPE_CYCLE_COUNTER(STAT_LayeredCameraSolve);
+
+    if (UPlayerCameraControlComponent* CameraControl = ResolveCameraControl(OutVT.Target))
+    {
+        CameraControl->UpdateCameraLayers(DeltaTime, *this);
+    }
+
+    UpdateShakeLayer(DeltaTime, OutVT.POV);
+    SolveLayers(OutVT.POV);
+}
+
+// 処理の流れ:
+// 1. 再生中のシェイクを合計
+// 2. なければレイヤーを無効化
+// 3. カメラローカルの位置オフセットをワールド空間に変換して書き込む
+void ALayeredCameraManager::UpdateShakeLayer(float DeltaTime, const FMinimalViewInfo& BaseView)
+{
+    FVector ShakeLocation;
+    FRotator ShakeRotation;
+    if (!ShakePool.Evaluate(DeltaTime, ShakeLocation, ShakeRotation))
+    {
+        ClearLayer(ECameraLayer::Shake);
+        return;
+    }
+
+    FCameraLayerValue ShakeLayer;
+    ShakeLayer.LocationOffset = BaseView.Rotation.RotateVector(ShakeLocation);
+    ShakeLayer.Rotation = ShakeRotation;
+    SetLayer(ECameraLayer::Shake, ShakeLayer);
+}
+
+// 処理の流れ:
+// 1. 無効なレイヤーはスキップ
+// 2. Additive は重みを掛けて加算
+// 3. Override は重みで置き換え（FOVは0以下なら変更しない）
+//    回転は ±180° をまたいでも近い側を通るよう、クォータニオンで補間する
+void ALayeredCameraManager::SolveLayers(FMinimalViewInfo& InOutPOV) const
+{
+    for (int32 Index = 0; Index < static_cast<int32>(ECameraLayer::Count); ++Index)
+    {
+        if (!bLayerActive[Index])
+        {
+            continue;
+        }
+
+        const FCameraLayerValue& Layer = Layers[Index];
+        const float Weight = FMath::Clamp(Layer.Weight, 0.0f, 1.0f);
+
+        if (Layer.Blend == ECameraLayerBlend::Additive)
+        {
+            InOutPOV.Location += Layer.LocationOffset * Weight;
+            InOutPOV.Rotation += Layer.Rotation * Weight;
+            InOutPOV.FOV += Layer.FOV * Weight;
+        }
+        else
+        {
+            InOutPOV.Rotation = FQuat::Slerp(InOutPOV.Rotation.Quaternion(), Layer.Rotation.Quaternion(), Weight).Rotator();
+            if (Layer.FOV > 0.0f)
+            {
+                InOutPOV.FOV = FMath::Lerp(InOutPOV.FOV, Layer.FOV, Weight);
+            }
+        }
+    }
+}
+
+UPlayerCameraControlComponent* ALayeredCameraManager::ResolveCameraControl(AActor* ViewTargetActor)
+{
+    if (CachedViewTargetActor.Get() != ViewTargetActor)
+    {
+        CachedViewTargetActor = ViewTargetActor;
+        CachedCameraControl = ViewTargetActor ? ViewTargetActor->FindComponentByClass<UPlayerCameraControlComponent>() : nullptr;
+    }
+
+    return CachedCameraControl.Get();
+}
@@ -0,0 +1,136 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Camera/ProceduralCameraShake.h"
+#include "LayeredCameraManager.generated.h"
+
+class UPlayerCameraControlComponent;
+
+/**
+ * @brief カメラレイヤーの種類（この順に評価する）
+ */
+UENUM(BlueprintType)
+enum class ECameraLayer : uint8
+{
+    Roll    UMETA(DisplayName = "Roll"),
+    HeadBob UMETA(DisplayName = "HeadBob"),
+    FOV     UMETA(DisplayName = "FOV"),
+    Shake   UMETA(DisplayName = "Shake"),
+    Rewind  UMETA(DisplayName = "Rewind"),
+    Count   UMETA(Hidden)
+};
+
+/**
+ * @brief レイヤーの合成方法
+ */
+UENUM(BlueprintType)
+enum class ECameraLayerBlend : uint8
+{
+    /** 下のレイヤーの結果に加算 */
+    Additive UMETA(DisplayName = "Additive"),
+
+    /** 下のレイヤーの結果を Weight で置き換える */
+    Override UMETA(DisplayName = "Override"),
+};
+
+/**
+ * @brief 1レイヤー分のカメラ値
+ */
+USTRUCT(BlueprintType)
+struct FCameraLayerValue
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
+    ECameraLayerBlend Blend = ECameraLayerBlend::Additive;
+
+    /** 合成の重み（0〜1） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
+    float Weight = 1.0f;
+
+    /** 位置オフセット（ワールド空間、Additive のみ） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
+    FVector LocationOffset = FVector::ZeroVector;
+
+    /** Additive: 回転オフセット / Override: 最終的な回転 */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
+    FRotator Rotation = FRotator::ZeroRotator;
+
+    /** Additive: FOVオフセット / Override: 最終的なFOV（0以下なら変更しない） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
+    float FOV = 0.0f;
+};
+
+/**
+ * @brief ロール・FOV・ヘッドボブ・シェイク・巻き戻しをレイヤーとして重ね、1フレーム1回だけ解決するカメラマネージャー
+ * @details 各機能はカメラコンポーネントを直接動かさず、レイヤーの値だけを書き込む。
+ *          UpdateViewTarget で全ゲームプレイ処理の後に評価順どおり合成するため、
+ *          更新順による揺れがなく、コストも "stat Game" の Camera Solve で計測できる。
+ *          PlayerController の PlayerCameraManagerClass に設定して使う。
+ */
+UCLASS()
+class CARRY_API ALayeredCameraManager : public APlayerCameraManager
+{
+    GENERATED_BODY()
+
+public:
+    ALayeredCameraManager();
+
+    /**
+     * @brief アクターを操作しているプレイヤーのカメラマネージャーを取得
+     * @return このクラスでなければ nullptr
+     */
+    static ALayeredCameraManager* FindForActor(const AActor* Actor);
+
+    /** @brief レイヤーの値を設定（有効化） */
+    void SetLayer(ECameraLayer Layer, const FCameraLayerValue& Value);
+
+    /** @brief レイヤーを無効化 */
+    void ClearLayer(ECameraLayer Layer);
+
+    /** @brief レイヤーが有効か */
+    bool IsLayerActive(ECameraLayer Layer) const;
+
+    /**
+     * @brief プロシージャルシェイクを再生（シェイクレイヤーに合成）
+     * @param Params シェイクのパラメータ
+     * @param Scale 振幅の倍率
+     */
+    void PlayProceduralShake(const FProceduralShakeParams& Params, float Scale = 1.0f);
+
+    /**
+     * @brief プロシージャルシェイクをすべて停止
+     * @param bImmediately true: 即座に停止、false: ブレンドアウト
+     */
+    void StopProceduralShakes(bool bImmediately);
+
+protected:
+    virtual void UpdateViewTarget(FTViewTarget& OutVT, float DeltaTime) override;
+
+private:
+    /** @brief シェイクプールを進めてシェイクレイヤーを更新 */
+    void UpdateShakeLayer(float DeltaTime, const FMinimalViewInfo& BaseView);
+
+    /** @brief 有効なレイヤーを評価順に POV へ合成 */
+    void SolveLayers(FMinimalViewInfo& InOutPOV) const;
+
+    /** @brief ビューターゲットのカメラ制御コンポーネントを取得（ターゲットが変わったときだけ検索） */
+    UPlayerCameraControlComponent* ResolveCameraControl(AActor* ViewTargetActor);
+
+private:
+    /** @brief レイヤーの値（評価順、事前確保） */
+    FCameraLayerValue Layers[static_cast<int32>(ECameraLayer::Count)];
+
+    /** @brief レイヤーの有効フラグ */
+    bool bLayerActive[static_cast<int32>(ECameraLayer::Count)] = {};
+
+    /** @brief プロシージャルシェイクのプール（事前確保） */
+    FProceduralCameraShakePool ShakePool;
+
+    /** @brief キャッシュしたビューターゲットとそのカメラ制御コンポーネント */
+    TWeakObjectPtr<AActor> CachedViewTargetActor;
+    TWeakObjectPtr<UPlayerCameraControlComponent> CachedCameraControl;
+};
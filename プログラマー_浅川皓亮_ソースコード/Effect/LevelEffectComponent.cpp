@@ -4,6 +4,9 @@
 #include "Component/LevelEffectComponent.h"
 #include "Components/PostProcessComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+#include "Curves/CurveFloat.h"
 #include "UE5Coro.h"
 
 using namespace UE5Coro;
@@ -42,7 +45,10 @@ void UPostProcessEffectManager::BeginPlay()
 
 // 処理の流れ:
 // 1. PostProcessComponentの有効性確認
-// 2. 初期化ログ出力
+// 2. フェードカーブを焼き込む
+// 3. 統合マテリアルを準備
+// 4. 個別マテリアルのインスタンスを事前に作成
+// 5. 初期化ログ出力
 void UPostProcessEffectManager::InitializePostProcess()
 {
     if (!PostProcessComponent)
@@ -51,7 +57,73 @@ void UPostProcessEffectManager::InitializePostProcess()
         return;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("PostProcessEffectManager: Initialized with %d effect configs"), EffectConfigs.Num());
+    BakeFadeTables();
+    InitializeUberMaterial();
+
+    if (bPrewarmMaterialInstances && !bUberModeActive)
+    {
+        MaterialInstanceCache.Reserve(EffectConfigs.Num());
+        for (const auto& Pair : EffectConfigs)
+        {
+            if (Pair.Key != EPostProcessEffectTag::None && Pair.Value.Material)
+            {
+                AcquireMaterialInstance(Pair.Key, Pair.Value);
+            }
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("PostProcessEffectManager: Initialized with %d effect configs (Uber: %d)"),
+        EffectConfigs.Num(), bUberModeActive);
+}
+
+void UPostProcessEffectManager::BakeFadeTables()
+{
+    FadeTables.Reset();
+    for (const auto& Pair : EffectConfigs)
+    {
+        FPostProcessFadeTables& Tables = FadeTables.Add(Pair.Key);
+        Tables.FadeIn.Bake(Pair.Value.FadeInCurve);
+        Tables.FadeOut.Bake(Pair.Value.FadeOutCurve);
+    }
+}
+
+// 処理の流れ:
+// 1. 統合マテリアルとパラメータコレクションが揃っているか確認
+// 2. マテリアルインスタンスとコレクションのインスタンスを取得
+// 3. 全エフェクトのウェイトを0に初期化
+void UPostProcessEffectManager::InitializeUberMaterial()
+{
+    bUberModeActive = false;
+    UberParameterNameCache.Reset();
+
+    if (!bUseUberMaterial)
+    {
+        return;
+    }
+
+    if (!UberMaterial || !UberParameterCollection)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("PostProcessEffectManager: Uber material or parameter collection not set, using per-effect materials"));
+        return;
+    }
+
+    UberMaterialInstance = UMaterialInstanceDynamic::Create(UberMaterial, this);
+    UberCollectionInstance = GetWorld()->GetParameterCollectionInstance(UberParameterCollection);
+    if (!UberMaterialInstance || !UberCollectionInstance)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("PostProcessEffectManager: Failed to create uber material instance, using per-effect materials"));
+        return;
+    }
+
+    for (const auto& Pair : EffectConfigs)
+    {
+        if (!Pair.Value.UberWeightParameter.IsNone())
+        {
+            UberCollectionInstance->SetScalarParameterValue(Pair.Value.UberWeightParameter, 0.0f);
+        }
+    }
+
+    bUberModeActive = true;
 }
 
 // ============================================
@@ -60,8 +132,9 @@ void UPostProcessEffectManager::InitializePostProcess()
 
 // 処理の流れ:
 // 1. タグとConfigの有効性確認
-// 2. すでにアクティブなら何もしない
-// 3. 新しいエフェクトを作成
+// 2. すでにアクティブなら何もしない（フェードアウト中なら取り消す）
+// 3. 新しいエフェクトを作成し、Blendable配列を作り直す
+//    （マテリアルのパラメータは前回の値を持ち越さないよう初期値に戻す）
 // 4. 即座に表示 or フェードイン
 void UPostProcessEffectManager::ActivateEffect(EPostProcessEffectTag Tag, bool bInstant)
 {
@@ -72,21 +145,43 @@ void UPostProcessEffectManager::ActivateEffect(EPostProcessEffectTag Tag, bool b
     }
 
     const FPostProcessEffectConfig* Config = EffectConfigs.Find(Tag);
-    if (!Config || !Config->Material)
+    if (!Config || (!bUberModeActive && !Config->Material))
     {
         UE_LOG(LogTemp, Warning, TEXT("PostProcessEffectManager: No config or material for tag %d"), static_cast<int32>(Tag));
         return;
     }
 
-    if (FindActiveEffect(Tag))
+    if (FActivePostProcessEffect* Existing = FindActiveEffect(Tag))
     {
+        // フェードアウト中なら取り消して戻す
+        if (Existing->bRemoveWhenFaded)
+        {
+            Existing->TargetWeight = Config->BlendWeight;
+            if (bInstant)
+            {
+                Existing->CurrentWeight = Config->BlendWeight;
+                Existing->bFading = false;
+                Existing->bRemoveWhenFaded = false;
+                ApplyEffectWeight(*Existing);
+            }
+            else
+            {
+                StartFade(*Existing, Config->BlendWeight, Config->FadeInDuration, false, EPostProcessFadeCurve::FadeIn);
+            }
+            return;
+        }
+
         UE_LOG(LogTemp, Log, TEXT("PostProcessEffectManager: Effect %d already active"), static_cast<int32>(Tag));
         return;
     }
 
     FActivePostProcessEffect NewEffect;
     NewEffect.Tag = Tag;
-    NewEffect.MaterialInstance = UMaterialInstanceDynamic::Create(Config->Material, this);
+    NewEffect.MaterialInstance = bUberModeActive ? nullptr : AcquireMaterialInstance(Tag, *Config);
+    if (bUberModeActive)
+    {
+        ResetUberParameters(Tag, *Config);
+    }
     NewEffect.TargetWeight = Config->BlendWeight;
     NewEffect.Priority = Config->Priority;
     NewEffect.CurrentWeight = bInstant ? Config->BlendWeight : 0.0f;
@@ -98,9 +193,15 @@ void UPostProcessEffectManager::ActivateEffect(EPostProcessEffectTag Tag, bool b
     UE_LOG(LogTemp, Log, TEXT("PostProcessEffectManager: Activated effect %d (Instant: %d)"),
         static_cast<int32>(Tag), bInstant);
 
-    if (!bInstant)
+    // BlendableIndex は RefreshPostProcessSettings で格納側にだけ振られるので、格納後の要素に適用する
+    if (FActivePostProcessEffect* Added = FindActiveEffect(Tag))
     {
-        FadeInEffect(Tag, Config->FadeInDuration);
+        ApplyEffectWeight(*Added);
+
+        if (!bInstant)
+        {
+            StartFade(*Added, Config->BlendWeight, Config->FadeInDuration, false, EPostProcessFadeCurve::FadeIn);
+        }
     }
 }
 
@@ -117,6 +218,8 @@ void UPostProcessEffectManager::DeactivateEffect(EPostProcessEffectTag Tag, bool
 
     if (bInstant)
     {
+        Effect->CurrentWeight = 0.0f;
+        ApplyEffectWeight(*Effect);
         ActiveEffects.RemoveAll([Tag](const FActivePostProcessEffect& E) { return E.Tag == Tag; });
         RefreshPostProcessSettings();
         UE_LOG(LogTemp, Log, TEXT("PostProcessEffectManager: Instantly deactivated effect %d"), static_cast<int32>(Tag));
@@ -125,7 +228,7 @@ void UPostProcessEffectManager::DeactivateEffect(EPostProcessEffectTag Tag, bool
     {
         const FPostProcessEffectConfig* Config = EffectConfigs.Find(Tag);
         const float Duration = Config ? Config->FadeOutDuration : 0.2f;
-        FadeOutEffect(Tag, Duration);
+        StartFade(*Effect, 0.0f, Duration, true, EPostProcessFadeCurve::FadeOut);
         UE_LOG(LogTemp, Log, TEXT("PostProcessEffectManager: Fading out effect %d"), static_cast<int32>(Tag));
     }
 }
@@ -136,6 +239,11 @@ void UPostProcessEffectManager::ClearAllEffects(bool bInstant)
 {
     if (bInstant)
     {
+        for (auto& Effect : ActiveEffects)
+        {
+            Effect.CurrentWeight = 0.0f;
+            ApplyEffectWeight(Effect);
+        }
         ActiveEffects.Empty();
         RefreshPostProcessSettings();
         UE_LOG(LogTemp, Log, TEXT("PostProcessEffectManager: Cleared all effects instantly"));
@@ -166,7 +274,7 @@ bool UPostProcessEffectManager::IsEffectActive(EPostProcessEffectTag Tag) const
 
 // 処理の流れ:
 // 1. エフェクトの存在確認
-// 2. ウェイト変更コルーチンを開始
+// 2. 目標ウェイトへのフェードを開始
 void UPostProcessEffectManager::SetEffectWeight(EPostProcessEffectTag Tag, float Weight)
 {
     FActivePostProcessEffect* Effect = FindActiveEffect(Tag);
@@ -176,13 +284,28 @@ void UPostProcessEffectManager::SetEffectWeight(EPostProcessEffectTag Tag, float
     }
 
     const float ClampedWeight = FMath::Clamp(Weight, 0.0f, 1.0f);
-    ChangeEffectWeight(Tag, ClampedWeight, 0.2f);
+    StartFade(*Effect, ClampedWeight, 0.2f, false);
 }
 
+// 処理の流れ:
+// 1. エフェクトの存在確認
+// 2. 統合マテリアルモードならパラメータコレクションへ、それ以外は個別マテリアルへ書き込む
 void UPostProcessEffectManager::SetEffectScalarParameter(EPostProcessEffectTag Tag, FName ParameterName, float Value)
 {
     FActivePostProcessEffect* Effect = FindActiveEffect(Tag);
-    if (Effect && Effect->MaterialInstance)
+    if (!Effect)
+    {
+        return;
+    }
+
+    if (bUberModeActive)
+    {
+        if (const FPostProcessEffectConfig* Config = EffectConfigs.Find(Tag))
+        {
+            UberCollectionInstance->SetScalarParameterValue(GetUberParameterName(Tag, *Config, ParameterName), Value);
+        }
+    }
+    else if (Effect->MaterialInstance)
     {
         Effect->MaterialInstance->SetScalarParameterValue(ParameterName, Value);
     }
@@ -191,28 +314,121 @@ void UPostProcessEffectManager::SetEffectScalarParameter(EPostProcessEffectTag T
 void UPostProcessEffectManager::SetEffectVectorParameter(EPostProcessEffectTag Tag, FName ParameterName, FLinearColor Value)
 {
     FActivePostProcessEffect* Effect = FindActiveEffect(Tag);
-    if (Effect && Effect->MaterialInstance)
+    if (!Effect)
+    {
+        return;
+    }
+
+    if (bUberModeActive)
+    {
+        if (const FPostProcessEffectConfig* Config = EffectConfigs.Find(Tag))
+        {
+            UberCollectionInstance->SetVectorParameterValue(GetUberParameterName(Tag, *Config, ParameterName), Value);
+        }
+    }
+    else if (Effect->MaterialInstance)
     {
         Effect->MaterialInstance->SetVectorParameterValue(ParameterName, Value);
     }
 }
 
+// 処理の流れ:
+// 1. エフェクトの存在確認
+// 2. パラメータコレクションはテクスチャを扱えないため、統合マテリアルモードでは統合マテリアルのインスタンスへ書き込む
 void UPostProcessEffectManager::SetEffectTextureParameter(EPostProcessEffectTag Tag, FName ParameterName, UTexture* Value)
 {
     FActivePostProcessEffect* Effect = FindActiveEffect(Tag);
-    if (Effect && Effect->MaterialInstance)
+    if (!Effect)
+    {
+        return;
+    }
+
+    if (bUberModeActive)
+    {
+        if (const FPostProcessEffectConfig* Config = EffectConfigs.Find(Tag))
+        {
+            UberMaterialInstance->SetTextureParameterValue(GetUberParameterName(Tag, *Config, ParameterName), Value);
+        }
+    }
+    else if (Effect->MaterialInstance)
     {
         Effect->MaterialInstance->SetTextureParameterValue(ParameterName, Value);
     }
 }
 
+// 処理の流れ:
+// 1. 接頭辞がなければそのまま返す
+// 2. キャッシュにあればそれを返す
+// 3. なければ「接頭辞_パラメータ名」を作ってキャッシュに登録
+FName UPostProcessEffectManager::GetUberParameterName(EPostProcessEffectTag Tag, const FPostProcessEffectConfig& Config, FName ParameterName)
+{
+    if (Config.UberParameterPrefix.IsNone())
+    {
+        return ParameterName;
+    }
+
+    TMap<FName, FName>& TagNames = UberParameterNameCache.FindOrAdd(Tag);
+    if (const FName* Cached = TagNames.Find(ParameterName))
+    {
+        return *Cached;
+    }
+
+    const FName UberName(*FString::Printf(TEXT("%s_%s"), *Config.UberParameterPrefix.ToString(), *ParameterName.ToString()));
+    TagNames.Add(ParameterName, UberName);
+    return UberName;
+}
+
+// 処理の流れ:
+// 1. 接頭辞がなければ他のエフェクトと共有の名前なので戻さない
+// 2. パラメータコレクションの「接頭辞_」で始まるスカラー・ベクターを既定値に戻す
+// 3. 統合マテリアルに書き込んだことのあるテクスチャを親マテリアルの値に戻す
+void UPostProcessEffectManager::ResetUberParameters(EPostProcessEffectTag Tag, const FPostProcessEffectConfig& Config)
+{
+    if (Config.UberParameterPrefix.IsNone())
+    {
+        return;
+    }
+
+    const FString Prefix = Config.UberParameterPrefix.ToString() + TEXT("_");
+
+    for (const FCollectionScalarParameter& Parameter : UberParameterCollection->ScalarParameters)
+    {
+        if (Parameter.ParameterName.ToString().StartsWith(Prefix))
+        {
+            UberCollectionInstance->SetScalarParameterValue(Parameter.ParameterName, Parameter.DefaultValue);
+        }
+    }
+
+    for (const FCollectionVectorParameter& Parameter : UberParameterCollection->VectorParameters)
+    {
+        if (Parameter.ParameterName.ToString().StartsWith(Prefix))
+        {
+            UberCollectionInstance->SetVectorParameterValue(Parameter.ParameterName, Parameter.DefaultValue);
+        }
+    }
+
+    if (const TMap<FName, FName>* TagNames = UberParameterNameCache.Find(Tag))
+    {
+        for (const TPair<FName, FName>& Pair : *TagNames)
+        {
+            UTexture* DefaultTexture = nullptr;
+            if (UberMaterial->GetTextureParameterValue(FHashedMaterialParameterInfo(Pair.Value), DefaultTexture))
+            {
+                UberMaterialInstance->SetTextureParameterValue(Pair.Value, DefaultTexture);
+            }
+        }
+    }
+}
+
 // ============================================
 // Internal Methods
 // ============================================
 
 // 処理の流れ:
 // 1. Blendableをクリア
-// 2. アクティブエフェクトをPostProcessComponentに追加
+// 2. 統合マテリアルモードなら、アクティブなエフェクトがある間だけ統合マテリアル1つを追加
+// 3. それ以外はアクティブエフェクトを優先度順に追加（ウェイト0も含めてスロットを固定）
+// 4. 各エフェクトにスロット位置を記録
 void UPostProcessEffectManager::RefreshPostProcessSettings()
 {
     if (!PostProcessComponent)
@@ -220,22 +436,84 @@ void UPostProcessEffectManager::RefreshPostProcessSettings()
         return;
     }
 
-    PostProcessComponent->Settings.WeightedBlendables.Array.Empty();
+    TArray<FWeightedBlendable>& Blendables = PostProcessComponent->Settings.WeightedBlendables.Array;
+    Blendables.Reset(ActiveEffects.Num());
 
-    for (const auto& Effect : ActiveEffects)
+    if (bUberModeActive)
     {
-        if (Effect.MaterialInstance && Effect.CurrentWeight > 0.0f)
+        if (ActiveEffects.Num() > 0)
         {
             FWeightedBlendable Blendable;
-            Blendable.Object = Effect.MaterialInstance;
-            Blendable.Weight = Effect.CurrentWeight;
-            PostProcessComponent->Settings.WeightedBlendables.Array.Add(Blendable);
+            Blendable.Object = UberMaterialInstance;
+            Blendable.Weight = 1.0f;
+            Blendables.Add(Blendable);
         }
+        return;
+    }
+
+    for (auto& Effect : ActiveEffects)
+    {
+        Effect.BlendableIndex = INDEX_NONE;
+        if (!Effect.MaterialInstance)
+        {
+            continue;
+        }
+
+        FWeightedBlendable Blendable;
+        Blendable.Object = Effect.MaterialInstance;
+        Blendable.Weight = Effect.CurrentWeight;
+        Effect.BlendableIndex = Blendables.Add(Blendable);
     }
 
     UE_LOG(LogTemp, Verbose, TEXT("PostProcessEffectManager: Refreshed with %d active effects"), ActiveEffects.Num());
 }
 
+// 処理の流れ:
+// 1. 統合マテリアルモードならパラメータコレクションのウェイトへ書き込む
+// 2. それ以外は自分のBlendableスロットのウェイトを書き換える
+void UPostProcessEffectManager::ApplyEffectWeight(const FActivePostProcessEffect& Effect)
+{
+    if (bUberModeActive)
+    {
+        const FPostProcessEffectConfig* Config = EffectConfigs.Find(Effect.Tag);
+        if (Config && !Config->UberWeightParameter.IsNone())
+        {
+            UberCollectionInstance->SetScalarParameterValue(Config->UberWeightParameter, Effect.CurrentWeight);
+        }
+        return;
+    }
+
+    if (!PostProcessComponent)
+    {
+        return;
+    }
+
+    TArray<FWeightedBlendable>& Blendables = PostProcessComponent->Settings.WeightedBlendables.Array;
+    if (Blendables.IsValidIndex(Effect.BlendableIndex))
+    {
+        Blendables[Effect.BlendableIndex].Weight = Effect.CurrentWeight;
+    }
+}
+
+// 処理の流れ:
+// 1. キャッシュにあり、親マテリアルが設定と同じならパラメータを初期値に戻して再利用
+// 2. なければ作成してキャッシュに登録
+UMaterialInstanceDynamic* UPostProcessEffectManager::AcquireMaterialInstance(EPostProcessEffectTag Tag, const FPostProcessEffectConfig& Config)
+{
+    if (UMaterialInstanceDynamic** Cached = MaterialInstanceCache.Find(Tag))
+    {
+        if (*Cached && (*Cached)->Parent == Config.Material)
+        {
+            (*Cached)->ClearParameterValues();
+            return *Cached;
+        }
+    }
+
+    UMaterialInstanceDynamic* MaterialInstance = UMaterialInstanceDynamic::Create(Config.Material, this);
+    MaterialInstanceCache.Add(Tag, MaterialInstance);
+    return MaterialInstance;
+}
+
 FActivePostProcessEffect* UPostProcessEffectManager::FindActiveEffect(EPostProcessEffectTag Tag)
 {
     return ActiveEffects.FindByPredicate([Tag](const FActivePostProcessEffect& E)
@@ -259,123 +537,122 @@ void UPostProcessEffectManager::SortActiveEffects()
 // ============================================
 
 // 処理の流れ:
-// 1. エフェクトの存在確認
-// 2. ウェイトを0から目標値まで補間
-// 3. 毎フレームPostProcessを更新
-TCoroutine<> UPostProcessEffectManager::FadeInEffect(EPostProcessEffectTag Tag, float Duration)
+// 1. 現在のウェイトを開始値として、目標ウェイト・時間・カーブ・完了時の削除を設定
+// 2. フェード更新コルーチンが止まっていれば開始
+void UPostProcessEffectManager::StartFade(FActivePostProcessEffect& Effect, float TargetWeight, float Duration, bool bRemoveWhenFaded,
+    EPostProcessFadeCurve Curve)
 {
-    FActivePostProcessEffect* Effect = FindActiveEffect(Tag);
-    if (!Effect)
+    const FPostProcessEffectConfig* Config = EffectConfigs.Find(Effect.Tag);
+
+    Effect.FadeStartWeight = Effect.CurrentWeight;
+    Effect.TargetWeight = TargetWeight;
+    Effect.FadeDuration = FMath::Max(Duration, 0.0f);
+    Effect.FadeElapsed = 0.0f;
+    Effect.FadeCurve = Curve;
+    Effect.bFadeIgnoresTimeDilation = Config && Config->bFadeIgnoresTimeDilation;
+    Effect.bRemoveWhenFaded = bRemoveWhenFaded;
+    Effect.bFading = true;
+
+    if (!bFadeLoopRunning)
     {
-        co_return;
+        UpdateFades();
     }
+}
 
-    const float TargetWeight = Effect->TargetWeight;
-    const float FadeSpeed = Duration > 0.0f ? (1.0f / Duration) : 10.0f;
-
-    while (Effect->CurrentWeight < TargetWeight - 0.01f)
+float UPostProcessEffectManager::EvaluateFade(const FActivePostProcessEffect& Effect, float Alpha) const
+{
+    const FPostProcessFadeTables* Tables = FadeTables.Find(Effect.Tag);
+    if (!Tables)
     {
-        co_await NextTick();
-
-        Effect = FindActiveEffect(Tag);
-        if (!Effect)
-        {
-            co_return;
-        }
-
-        Effect->CurrentWeight = FMath::FInterpTo(
-            Effect->CurrentWeight,
-            TargetWeight,
-            GetWorld()->GetDeltaSeconds(),
-            FadeSpeed
-        );
-
-        RefreshPostProcessSettings();
+        return Alpha;
     }
 
-    if (Effect)
+    switch (Effect.FadeCurve)
     {
-        Effect->CurrentWeight = TargetWeight;
-        RefreshPostProcessSettings();
+    case EPostProcessFadeCurve::FadeIn:
+        return Tables->FadeIn.Evaluate(Alpha);
+    case EPostProcessFadeCurve::FadeOut:
+        return Tables->FadeOut.Evaluate(Alpha);
+    default:
+        return Alpha;
     }
 }
 
 // 処理の流れ:
-// 1. エフェクトの存在確認
-// 2. ウェイトを目標値から0まで補間
-// 3. 完了したらエフェクトを削除
-TCoroutine<> UPostProcessEffectManager::FadeOutEffect(EPostProcessEffectTag Tag, float Duration)
+// 1. 次のフレームを待ち、遅延あり・なしの経過時間を1回だけ取得
+// 2. フェード中の全エフェクトの経過時間を進め、焼き込み済みカーブでウェイトを求めて自分のスロットへ直接書き込む
+// 3. フェードアウトが終わったエフェクトがあれば削除してBlendable配列を作り直す
+// 4. フェード中のエフェクトがなくなったら終了
+TCoroutine<> UPostProcessEffectManager::UpdateFades()
 {
-    FActivePostProcessEffect* Effect = FindActiveEffect(Tag);
-    if (!Effect)
-    {
-        co_return;
-    }
-
-    const float FadeSpeed = Duration > 0.0f ? (1.0f / Duration) : 10.0f;
+    bFadeLoopRunning = true;
 
-    while (Effect && Effect->CurrentWeight > 0.01f)
+    bool bAnyFading = true;
+    while (bAnyFading)
     {
         co_await NextTick();
 
-        Effect = FindActiveEffect(Tag);
-        if (!Effect)
+        const UWorld* World = GetWorld();
+        const float DilatedDeltaTime = World->GetDeltaSeconds();
+        const float RealDeltaTime = World->DeltaRealTimeSeconds;
+        bAnyFading = false;
+        bool bAnyRemoved = false;
+
+        for (auto& Effect : ActiveEffects)
         {
-            co_return;
+            if (!Effect.bFading)
+            {
+                continue;
+            }
+
+            Effect.FadeElapsed += Effect.bFadeIgnoresTimeDilation ? RealDeltaTime : DilatedDeltaTime;
+
+            if (Effect.FadeElapsed >= Effect.FadeDuration)
+            {
+                Effect.CurrentWeight = Effect.TargetWeight;
+                Effect.bFading = false;
+                bAnyRemoved |= Effect.bRemoveWhenFaded;
+            }
+            else
+            {
+                const float Progress = EvaluateFade(Effect, Effect.FadeElapsed / Effect.FadeDuration);
+                Effect.CurrentWeight = FMath::Lerp(Effect.FadeStartWeight, Effect.TargetWeight, Progress);
+                bAnyFading = true;
+            }
+
+            ApplyEffectWeight(Effect);
         }
 
-        Effect->CurrentWeight = FMath::FInterpTo(
-            Effect->CurrentWeight,
-            0.0f,
-            GetWorld()->GetDeltaSeconds(),
-            FadeSpeed
-        );
-
-        RefreshPostProcessSettings();
+        if (bAnyRemoved)
+        {
+            ActiveEffects.RemoveAll([](const FActivePostProcessEffect& E) { return E.bRemoveWhenFaded && !E.bFading; });
+            RefreshPostProcessSettings();
+            UE_LOG(LogTemp, Log, TEXT("PostProcessEffectManager: Removed faded-out effects"));
+        }
     }
 
-    ActiveEffects.RemoveAll([Tag](const FActivePostProcessEffect& E) { return E.Tag == Tag; });
-    RefreshPostProcessSettings();
-    UE_LOG(LogTemp, Log, TEXT("PostProcessEffectManager: Removed effect %d"), static_cast<int32>(Tag));
+    bFadeLoopRunning = false;
 }
 
+// ============================================
+// Fade Table
+// ============================================
+
 // 処理の流れ:
-// 1. エフェクトの存在確認
-// 2. 現在のウェイトから目標値まで補間
-TCoroutine<> UPostProcessEffectManager::ChangeEffectWeight(EPostProcessEffectTag Tag, float TargetWeight, float Duration)
+// 1. カーブがなければ線形で埋める
+// 2. 経過率 0〜1 を等間隔にサンプリングして 0〜1 にクランプ
+void FPostProcessFadeTable::Bake(const UCurveFloat* Curve)
 {
-    FActivePostProcessEffect* Effect = FindActiveEffect(Tag);
-    if (!Effect)
+    for (int32 Index = 0; Index <= SampleCount; ++Index)
     {
-        co_return;
-    }
-
-    const float FadeSpeed = Duration > 0.0f ? (1.0f / Duration) : 10.0f;
-
-    while (FMath::Abs(Effect->CurrentWeight - TargetWeight) > 0.01f)
-    {
-        co_await NextTick();
-
-        Effect = FindActiveEffect(Tag);
-        if (!Effect)
-        {
-            co_return;
-        }
-
-        Effect->CurrentWeight = FMath::FInterpTo(
-            Effect->CurrentWeight,
-            TargetWeight,
-            GetWorld()->GetDeltaSeconds(),
-            FadeSpeed
-        );
-
-        RefreshPostProcessSettings();
+        const float Alpha = static_cast<float>(Index) / SampleCount;
+        Samples[Index] = Curve ? FMath::Clamp(Curve->GetFloatValue(Alpha), 0.0f, 1.0f) : Alpha;
     }
+}
 
-    if (Effect)
-    {
-        Effect->CurrentWeight = TargetWeight;
-        Effect->TargetWeight = TargetWeight;
-        RefreshPostProcessSettings();
-    }
-}
\ No newline at end of file
+float FPostProcessFadeTable::Evaluate(float Alpha) const
+{
+    const float Position = FMath::Clamp(Alpha, 0.0f, 1.0f) * SampleCount;
+    const int32 Index = FMath::Min(FMath::FloorToInt32(Position), SampleCount - 1);
+    return FMath::Lerp(Samples[Index], Samples[Index + 1], Position - Index);
+}
@@ -8,6 +8,9 @@
 #include "LevelEffectComponent.generated.h"
 
 class UPostProcessComponent;
+class UMaterialParameterCollection;
+class UMaterialParameterCollectionInstance;
+class UCurveFloat;
 
 /**
  * @brief ポストプロセスエフェクトのタグ
@@ -28,6 +31,32 @@ enum class EPostProcessEffectTag : uint8
     Custom3         UMETA(DisplayName = "Custom 3")
 };
 
+/**
+ * @brief フェードに使うカーブの種類
+ */
+enum class EPostProcessFadeCurve : uint8
+{
+    Linear,
+    FadeIn,
+    FadeOut,
+};
+
+/**
+ * @brief カーブを焼き込んだルックアップテーブル（経過率 0〜1 → 進行度 0〜1）
+ */
+struct FPostProcessFadeTable
+{
+    static constexpr int32 SampleCount = 32;
+
+    float Samples[SampleCount + 1];
+
+    /** @brief カーブを焼き込む（nullptr なら線形） */
+    void Bake(const UCurveFloat* Curve);
+
+    /** @brief 経過率から進行度を線形補間で引く */
+    float Evaluate(float Alpha) const;
+};
+
 /**
  * @brief エフェクト設定
  */
@@ -50,6 +79,26 @@ struct FPostProcessEffectConfig
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effect", meta = (ClampMin = "0.0"))
     float FadeOutDuration = 0.2f;
+
+    /** フェードインの進み方（横軸: 経過率 0〜1、縦軸: 進行度 0〜1。未設定なら線形） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effect")
+    UCurveFloat* FadeInCurve = nullptr;
+
+    /** フェードアウトの進み方（横軸: 経過率 0〜1、縦軸: 進行度 0〜1。未設定なら線形） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effect")
+    UCurveFloat* FadeOutCurve = nullptr;
+
+    /** フェードを時間の遅延（スローモーション）の影響を受けずに進めるか */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effect")
+    bool bFadeIgnoresTimeDilation = false;
+
+    /** 統合マテリアル使用時: このエフェクトのウェイトを書き込むパラメータコレクションのスカラー名 */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effect|Uber")
+    FName UberWeightParameter;
+
+    /** 統合マテリアル使用時: パラメータ名の接頭辞（"接頭辞_パラメータ名" に書き込む） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effect|Uber")
+    FName UberParameterPrefix;
 };
 
 /**
@@ -68,6 +117,37 @@ struct FActivePostProcessEffect
     float CurrentWeight = 0.0f;
     float TargetWeight = 1.0f;
     int32 Priority = 50;
+
+    /** WeightedBlendables 内の位置（集合が変わったときだけ振り直す） */
+    int32 BlendableIndex = INDEX_NONE;
+
+    /** フェード中か */
+    bool bFading = false;
+
+    /** フェード完了時に削除するか（フェードアウト） */
+    bool bRemoveWhenFaded = false;
+
+    /** フェード開始時のウェイト */
+    float FadeStartWeight = 0.0f;
+
+    /** フェード時間と経過時間 */
+    float FadeDuration = 0.0f;
+    float FadeElapsed = 0.0f;
+
+    /** 使うカーブ */
+    EPostProcessFadeCurve FadeCurve = EPostProcessFadeCurve::Linear;
+
+    /** 時間の遅延を無視して進めるか */
+    bool bFadeIgnoresTimeDilation = false;
+};
+
+/**
+ * @brief エフェクトごとの焼き込み済みフェードテーブル
+ */
+struct FPostProcessFadeTables
+{
+    FPostProcessFadeTable FadeIn;
+    FPostProcessFadeTable FadeOut;
 };
 
 /**
@@ -81,6 +161,7 @@ struct FActivePostProcessEffect
  * - フェードイン/アウト対応
  * - 優先度システム
  * - 重複防止
+ * - 統合マテリアルモード（全エフェクトを1パスで描画し、ウェイトとパラメータはパラメータコレクションで渡す）
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class CARRY_API UPostProcessEffectManager : public UActorComponent
@@ -159,23 +240,55 @@ private:
     /** @brief ポストプロセスコンポーネントを初期化 */
     void InitializePostProcess();
 
+    /**
+     * @brief タグのマテリアルインスタンスをキャッシュから取得（なければ作成）
+     * @details 再利用時はパラメータをマテリアルの初期値に戻す
+     */
+    UMaterialInstanceDynamic* AcquireMaterialInstance(EPostProcessEffectTag Tag, const FPostProcessEffectConfig& Config);
+
+    /** @brief 全エフェクトのフェードカーブをテーブルに焼き込む */
+    void BakeFadeTables();
+
+    /** @brief 統合マテリアルとパラメータコレクションを準備（揃っていなければ個別マテリアルに戻す） */
+    void InitializeUberMaterial();
+
+    /** @brief 統合マテリアル用のパラメータ名（接頭辞_パラメータ名）を取得（タグとパラメータごとに一度だけ作る） */
+    FName GetUberParameterName(EPostProcessEffectTag Tag, const FPostProcessEffectConfig& Config, FName ParameterName);
+
+    /**
+     * @brief 統合マテリアルのタグのパラメータ（接頭辞付き）を初期値に戻す
+     * @details 個別マテリアルの再利用時に ClearParameterValues するのと同じく、前回の値を持ち越さないようにする
+     */
+    void ResetUberParameters(EPostProcessEffectTag Tag, const FPostProcessEffectConfig& Config);
+
     /** @brief アクティブエフェクトを取得 */
     FActivePostProcessEffect* FindActiveEffect(EPostProcessEffectTag Tag);
 
     /** @brief アクティブエフェクトを優先度順にソート */
     void SortActiveEffects();
 
-    /** @brief PostProcessComponentを更新 */
+    /** @brief Blendable配列を作り直す（エフェクトの集合が変わったときだけ呼ぶ） */
     void RefreshPostProcessSettings();
 
-    /** @brief フェードインコルーチン */
-    UE5Coro::TCoroutine<> FadeInEffect(EPostProcessEffectTag Tag, float Duration);
+    /** @brief エフェクトのウェイトを自分のBlendableスロットへ直接書き込む */
+    void ApplyEffectWeight(const FActivePostProcessEffect& Effect);
+
+    /**
+     * @brief フェードを開始（進行は UpdateFades でまとめて行う）
+     * @param Effect 対象エフェクト
+     * @param TargetWeight 目標ウェイト
+     * @param Duration フェード時間
+     * @param bRemoveWhenFaded 完了時に削除するか
+     * @param Curve 進み方
+     */
+    void StartFade(FActivePostProcessEffect& Effect, float TargetWeight, float Duration, bool bRemoveWhenFaded,
+        EPostProcessFadeCurve Curve = EPostProcessFadeCurve::Linear);
 
-    /** @brief フェードアウトコルーチン */
-    UE5Coro::TCoroutine<> FadeOutEffect(EPostProcessEffectTag Tag, float Duration);
+    /** @brief エフェクトのフェード進行度を焼き込み済みテーブルから求める */
+    float EvaluateFade(const FActivePostProcessEffect& Effect, float Alpha) const;
 
-    /** @brief ウェイト変更コルーチン */
-    UE5Coro::TCoroutine<> ChangeEffectWeight(EPostProcessEffectTag Tag, float TargetWeight, float Duration);
+    /** @brief フェード中の全エフェクトを1パスで進めるコルーチン（フェードがなくなったら終了） */
+    UE5Coro::TCoroutine<> UpdateFades();
 
 private:
     // ============================================
@@ -194,6 +307,22 @@ private:
     UPROPERTY(EditAnywhere, Category = "Post Process|Settings")
     float PostProcessPriority = 1.0f;
 
+    /** @brief 全エフェクトを1つの統合マテリアルで描画するか（重ねても1パス） */
+    UPROPERTY(EditAnywhere, Category = "Post Process|Uber")
+    bool bUseUberMaterial = false;
+
+    /** @brief 統合マテリアル（各エフェクトのウェイトをパラメータコレクションから読む） */
+    UPROPERTY(EditAnywhere, Category = "Post Process|Uber", meta = (EditCondition = "bUseUberMaterial"))
+    UMaterialInterface* UberMaterial = nullptr;
+
+    /** @brief 統合マテリアルが読むパラメータコレクション */
+    UPROPERTY(EditAnywhere, Category = "Post Process|Uber", meta = (EditCondition = "bUseUberMaterial"))
+    UMaterialParameterCollection* UberParameterCollection = nullptr;
+
+    /** @brief 初期化時に全エフェクトのマテリアルインスタンスを作っておくか（false なら初回有効化時に作成） */
+    UPROPERTY(EditAnywhere, Category = "Post Process|Settings")
+    bool bPrewarmMaterialInstances = true;
+
 private:
     // ============================================
     // Cached References
@@ -211,4 +340,28 @@ private:
     /** @brief アクティブなエフェクト一覧 */
     UPROPERTY()
     TArray<FActivePostProcessEffect> ActiveEffects;
+
+    /** @brief 統合マテリアルのインスタンス */
+    UPROPERTY()
+    UMaterialInstanceDynamic* UberMaterialInstance = nullptr;
+
+    /** @brief 統合マテリアル用パラメータコレクションのワールド内インスタンス */
+    UPROPERTY()
+    UMaterialParameterCollectionInstance* UberCollectionInstance = nullptr;
+
+    /** @brief 統合マテリアルモードで動作中か（設定が揃っている場合のみ true） */
+    bool bUberModeActive = false;
+
+    /** @brief タグごとのマテリアルインスタンス（有効化・無効化で使い回す） */
+    UPROPERTY()
+    TMap<EPostProcessEffectTag, UMaterialInstanceDynamic*> MaterialInstanceCache;
+
+    /** @brief 焼き込み済みのフェードテーブル（初期化時に作成） */
+    TMap<EPostProcessEffectTag, FPostProcessFadeTables> FadeTables;
+
+    /** @brief 統合マテリアル用パラメータ名のキャッシュ（タグ → 元のパラメータ名 → 接頭辞付きの名前） */
+    TMap<EPostProcessEffectTag, TMap<FName, FName>> UberParameterNameCache;
+
+    /** @brief フェード更新コルーチンが動いているか */
+    bool bFadeLoopRunning = false;
 };
\ No newline at end of file
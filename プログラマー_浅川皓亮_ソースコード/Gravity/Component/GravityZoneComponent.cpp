@@ -0,0 +1,96 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Component/GravityZoneComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Component/TimeManipulatorComponent.h"
+
+using namespace UE5Coro::Latent;
+
+UGravityZoneComponent::UGravityZoneComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+// 処理の流れ:
+// 1. MovementComponent・TimeManipulator・サブシステムをキャッシュ
+// 2. 更新ループを開始
+void UGravityZoneComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (ACharacter* Character = Cast<ACharacter>(GetOwner()))
+    {
+        CachedMovement = Character->GetCharacterMovement();
+    }
+
+    CachedTimeManipulator = GetOwner()->FindComponentByClass<UTimeManipulatorComponent>();
+    CachedSubsystem = GetWorld()->GetSubsystem<UGravityZoneSubsystem>();
+
+    if (!CachedMovement.IsValid() || !CachedSubsystem.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GravityZoneComponent: CharacterMovement or subsystem is invalid"));
+        return;
+    }
+
+    BaseGravityScale = CachedMovement->GravityScale;
+
+    bShouldStop = false;
+    UpdateLoop();
+}
+
+void UGravityZoneComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    bShouldStop = true;
+    Super::EndPlay(EndPlayReason);
+}
+
+TCoroutine<> UGravityZoneComponent::UpdateLoop()
+{
+    while (!bShouldStop && CachedMovement.IsValid())
+    {
+        co_await NextTick();
+        UpdateGravity();
+    }
+}
+
+// 処理の流れ:
+// 1. 巻き戻し中は何もしない
+// 2. キャッシュ付きでゾーンを問い合わせ
+// 3. ゾーン外に居続ける間は他の処理が設定した重力方向を上書きしない
+// 4. 方向・倍率が変わったときのみ MovementComponent に反映
+void UGravityZoneComponent::UpdateGravity()
+{
+    if (!CachedMovement.IsValid() || !CachedSubsystem.IsValid())
+    {
+        return;
+    }
+
+    if (CachedTimeManipulator.IsValid() && CachedTimeManipulator->IsRewinding())
+    {
+        return;
+    }
+
+    CurrentSample = CachedSubsystem->QueryGravity(GetOwner()->GetActorLocation(), ZoneCache);
+
+    const bool bInZone = CurrentSample.IsInZone();
+    if (!bInZone && !bWasInZone)
+    {
+        return;
+    }
+    bWasInZone = bInZone;
+
+    if (!CachedMovement->GetGravityDirection().Equals(CurrentSample.Direction, DirectionTolerance))
+    {
+        CachedMovement->SetGravityDirection(CurrentSample.Direction);
+        OnGravityDirectionChanged.Broadcast(CurrentSample.Direction);
+    }
+
+    // ゾーン外では倍率1なので元の値に戻る
+    const float TargetGravityScale = BaseGravityScale * CurrentSample.Scale;
+    if (!FMath::IsNearlyEqual(CachedMovement->GravityScale, TargetGravityScale))
+    {
+        CachedMovement->GravityScale = TargetGravityScale;
+    }
+}
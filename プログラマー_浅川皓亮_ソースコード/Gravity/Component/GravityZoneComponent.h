@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "UE5Coro.h"
+#include "SubSystem/GravityZoneSubsystem.h"
+#include "GravityZoneComponent.generated.h"
+
+class UCharacterMovementComponent;
+class UTimeManipulatorComponent;
+
+using namespace UE5Coro;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnGravityZoneDirectionChanged, FVector);
+
+/**
+ * @brief キャラクターの重力方向を重力ゾーンに追従させるコンポーネント
+ *
+ * UGravityZoneSubsystem をキャッシュ付きで問い合わせ、方向が変わったときだけ
+ * CharacterMovement の SetGravityDirection を呼ぶ。
+ * ゾーンの重力倍率は BeginPlay 時の CharacterMovement の GravityScale に掛けて反映する。
+ * 巻き戻し中は TimeManipulator が記録済みの重力方向を適用するため更新しない。
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class CARRY_API UGravityZoneComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UGravityZoneComponent();
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+    /** @brief 直近の問い合わせ結果（毎フレームのコルーチンで更新するため、同じフレームの移動より後になることがある） */
+    const FGravitySample& GetGravitySample() const { return CurrentSample; }
+
+    /** 重力方向が変わった際に発火 */
+    FOnGravityZoneDirectionChanged OnGravityDirectionChanged;
+
+private:
+    /** @brief 更新ループ（コルーチン） */
+    TCoroutine<> UpdateLoop();
+
+    /** @brief 現在位置の重力を取得し、変化があれば反映 */
+    void UpdateGravity();
+
+private:
+    /** 方向が変わったとみなす誤差 */
+    UPROPERTY(EditAnywhere, Category = "Gravity")
+    float DirectionTolerance = 0.01f;
+
+    UPROPERTY()
+    TWeakObjectPtr<UCharacterMovementComponent> CachedMovement;
+
+    UPROPERTY()
+    TWeakObjectPtr<UTimeManipulatorComponent> CachedTimeManipulator;
+
+    UPROPERTY()
+    TWeakObjectPtr<UGravityZoneSubsystem> CachedSubsystem;
+
+    /** ゾーン外での CharacterMovement の GravityScale（BeginPlay 時の値） */
+    float BaseGravityScale = 1.0f;
+
+    /** ゾーン問い合わせキャッシュ */
+    FGravityZoneCache ZoneCache;
+
+    /** 直近の問い合わせ結果 */
+    FGravitySample CurrentSample;
+
+    /** 前回ゾーン内にいたか */
+    bool bWasInZone = false;
+
+    /** コルーチン停止フラグ */
+    bool bShouldStop = false;
+};
@@ -0,0 +1,184 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SubSystem/GravityZoneSubsystem.h"
+#include "Object/Gravity/GravityZoneVolume.h"
+
+void UGravityZoneSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    UE_LOG(LogTemp, Log, TEXT("GravityZoneSubsystem: Initialized"));
+}
+
+void UGravityZoneSubsystem::Deinitialize()
+{
+    Zones.Empty();
+    CellToZone.Empty();
+    CellZones.Empty();
+    Super::Deinitialize();
+}
+
+// 処理の流れ:
+// 1. ゾーンを追加
+// 2. そのゾーンのセルだけ書き込む
+void UGravityZoneSubsystem::RegisterZone(AGravityZoneVolume* Zone)
+{
+    if (!Zone || Zones.Contains(Zone))
+    {
+        return;
+    }
+
+    const int32 ZoneId = Zones.Add(Zone);
+    RasterizeZone(ZoneId);
+    ++GridVersion;
+
+    UE_LOG(LogTemp, Log, TEXT("GravityZone: Registered %s (Id=%d, Cells=%d)"),
+        *Zone->GetName(), ZoneId, CellToZone.Num());
+}
+
+// 処理の流れ:
+// 1. スロットを空にする（IDは詰めない）
+// 2. グリッドを再構築
+void UGravityZoneSubsystem::UnregisterZone(AGravityZoneVolume* Zone)
+{
+    const int32 ZoneId = Zones.IndexOfByKey(Zone);
+    if (ZoneId == INDEX_NONE)
+    {
+        return;
+    }
+
+    Zones[ZoneId].Reset();
+    RebuildGrid();
+}
+
+// 処理の流れ:
+// 1. セルが変わった or グリッドが更新された場合のみ候補リストを引き直す
+// 2. 候補を優先度順に形状で判定し、最初に含むゾーンの方向と倍率を評価
+FGravitySample UGravityZoneSubsystem::QueryGravity(const FVector& Location, FGravityZoneCache& Cache) const
+{
+    const FIntVector Cell = ToCell(Location);
+
+    if (Cache.Cell != Cell || Cache.GridVersion != GridVersion)
+    {
+        const int32* Found = CellToZone.Find(Cell);
+        Cache.Cell = Cell;
+        Cache.GridVersion = GridVersion;
+        Cache.CellIndex = Found ? *Found : INDEX_NONE;
+    }
+
+    FGravitySample Sample;
+
+    if (!CellZones.IsValidIndex(Cache.CellIndex))
+    {
+        return Sample;
+    }
+
+    for (const int32 ZoneId : CellZones[Cache.CellIndex].ZoneIds)
+    {
+        const AGravityZoneVolume* Zone = Zones[ZoneId].Get();
+        if (!Zone || !Zone->ContainsPoint(Location))
+        {
+            continue;
+        }
+
+        Sample.Direction = Zone->EvaluateDirection(Location);
+        Sample.Scale = Zone->GetGravityScale();
+        Sample.ZoneId = ZoneId;
+        break;
+    }
+
+    return Sample;
+}
+
+// 処理の流れ:
+// 1. グリッドをクリア
+// 2. 有効な全ゾーンを書き込む
+void UGravityZoneSubsystem::RebuildGrid()
+{
+    CellToZone.Reset();
+    CellZones.Reset();
+
+    for (int32 ZoneId = 0; ZoneId < Zones.Num(); ++ZoneId)
+    {
+        if (Zones[ZoneId].IsValid())
+        {
+            RasterizeZone(ZoneId);
+        }
+    }
+
+    ++GridVersion;
+}
+
+// 処理の流れ:
+// 1. ゾーンのAABBが覆うセル範囲を求める
+// 2. セルの箱がゾーンと重なるなら、そのセルの候補に優先度順で挿入
+void UGravityZoneSubsystem::RasterizeZone(int32 ZoneId)
+{
+    const AGravityZoneVolume* Zone = Zones[ZoneId].Get();
+    if (!Zone)
+    {
+        return;
+    }
+
+    const FBox Box = Zone->GetWorldBounds();
+    const FIntVector MinCell = ToCell(Box.Min);
+    const FIntVector MaxCell = ToCell(Box.Max);
+
+    const int64 CellCount =
+        int64(MaxCell.X - MinCell.X + 1) *
+        int64(MaxCell.Y - MinCell.Y + 1) *
+        int64(MaxCell.Z - MinCell.Z + 1);
+
+    if (CellCount > MaxCellsPerZoneWarning)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GravityZone: %s covers %lld cells. Consider a larger CellSize."),
+            *Zone->GetName(), CellCount);
+    }
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+            {
+                const FIntVector Cell(X, Y, Z);
+                const FVector CellMin = FVector(Cell) * CellSize;
+                const FBox CellBox(CellMin, CellMin + FVector(CellSize));
+
+                if (!Zone->IntersectsBox(CellBox))
+                {
+                    continue;
+                }
+
+                int32& CellIndex = CellToZone.FindOrAdd(Cell, INDEX_NONE);
+                if (CellIndex == INDEX_NONE)
+                {
+                    CellIndex = CellZones.AddDefaulted();
+                }
+
+                // 優先度の高い順を保つ（同じ優先度は先に登録したものを優先）
+                TArray<int32, TInlineAllocator<2>>& ZoneIds = CellZones[CellIndex].ZoneIds;
+                int32 InsertIndex = 0;
+                while (InsertIndex < ZoneIds.Num())
+                {
+                    const AGravityZoneVolume* Existing = Zones[ZoneIds[InsertIndex]].Get();
+                    if (Existing && Existing->GetPriority() < Zone->GetPriority())
+                    {
+                        break;
+                    }
+                    ++InsertIndex;
+                }
+                ZoneIds.Insert(ZoneId, InsertIndex);
+            }
+        }
+    }
+}
+
+FIntVector UGravityZoneSubsystem::ToCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X / CellSize),
+        FMath::FloorToInt(Location.Y / CellSize),
+        FMath::FloorToInt(Location.Z / CellSize)
+    );
+}
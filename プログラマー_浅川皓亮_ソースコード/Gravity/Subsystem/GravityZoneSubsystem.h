@@ -0,0 +1,142 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GravityZoneSubsystem.generated.h"
+
+class AGravityZoneVolume;
+
+/**
+ * @brief ある位置での重力の評価結果
+ */
+USTRUCT(BlueprintType)
+struct FGravitySample
+{
+    GENERATED_BODY()
+
+    /** 重力方向（正規化済み） */
+    UPROPERTY(BlueprintReadOnly, Category = "Gravity")
+    FVector Direction = FVector::DownVector;
+
+    /** 重力の強さの倍率 */
+    UPROPERTY(BlueprintReadOnly, Category = "Gravity")
+    float Scale = 1.0f;
+
+    /** 所属するゾーンID（ゾーン外は INDEX_NONE） */
+    UPROPERTY(BlueprintReadOnly, Category = "Gravity")
+    int32 ZoneId = INDEX_NONE;
+
+    bool IsInZone() const { return ZoneId != INDEX_NONE; }
+};
+
+/**
+ * @brief 問い合わせ側が保持するキャッシュ
+ * @details セルをまたぐか、グリッドが再構築されたときだけゾーンIDを引き直す
+ */
+struct FGravityZoneCache
+{
+    /** 前回問い合わせたセル */
+    FIntVector Cell = FIntVector(MAX_int32);
+
+    /** 前回問い合わせ時のグリッドバージョン（0 = 未解決） */
+    uint32 GridVersion = 0;
+
+    /** 解決済みのセルの候補リスト（CellZones のインデックス、候補なしは INDEX_NONE） */
+    int32 CellIndex = INDEX_NONE;
+};
+
+/**
+ * @brief 1セルに重なるゾーンの候補（優先度の高い順）
+ */
+struct FGravityCellZones
+{
+    TArray<int32, TInlineAllocator<2>> ZoneIds;
+};
+
+/**
+ * @brief 重力ゾーンの空間インデックス
+ *
+ * ゾーンを登録時に一様グリッドへ焼き込み、セル単位で候補ゾーンを引く。
+ * セルには範囲が重なるゾーンをすべて優先度順に登録し、問い合わせ時に
+ * ゾーンの形状で正確に判定する（セルより小さいゾーンも取りこぼさない）。
+ *
+ * **主な最適化**
+ * - オーバーラップイベント不使用（毎フレームの重なり判定なし）
+ * - 問い合わせ側のキャッシュで、同じセル内ではマップ検索もしない
+ *
+ * 設定は DefaultGame.ini の [/Script/Carry.GravityZoneSubsystem] で変更する。
+ */
+UCLASS(Config = Game)
+class CARRY_API UGravityZoneSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // ============================================
+    // Public API
+    // ============================================
+
+    void RegisterZone(AGravityZoneVolume* Zone);
+    void UnregisterZone(AGravityZoneVolume* Zone);
+
+    /**
+     * @brief 位置での重力を取得
+     * @param Location ワールド座標
+     * @param Cache 呼び出し側ごとのキャッシュ
+     * @return ゾーン外ならデフォルト（下向き・倍率1）
+     */
+    FGravitySample QueryGravity(const FVector& Location, FGravityZoneCache& Cache) const;
+
+    /** @brief グリッドのバージョン（ゾーンの増減で変わる） */
+    uint32 GetGridVersion() const { return GridVersion; }
+
+private:
+    // ============================================
+    // Internal Logic
+    // ============================================
+
+    /** @brief 全ゾーンからグリッドを作り直す */
+    void RebuildGrid();
+
+    /** @brief 1ゾーン分のセルを書き込む */
+    void RasterizeZone(int32 ZoneId);
+
+    /** @brief ワールド座標 → セル座標 */
+    FIntVector ToCell(const FVector& Location) const;
+
+private:
+    // ============================================
+    // Zone Management
+    // ============================================
+
+    /** 登録済みゾーン（インデックス = ゾーンID。解除後はnull） */
+    UPROPERTY()
+    TArray<TWeakObjectPtr<AGravityZoneVolume>> Zones;
+
+    /** セル → CellZones のインデックス */
+    TMap<FIntVector, int32> CellToZone;
+
+    /** セルごとの候補ゾーン */
+    TArray<FGravityCellZones> CellZones;
+
+    /** グリッドのバージョン */
+    uint32 GridVersion = 1;
+
+private:
+    // ============================================
+    // Settings
+    // ============================================
+
+    /** セルの一辺（uu） */
+    UPROPERTY(Config)
+    float CellSize = 200.0f;
+
+    /** 1ゾーンが占有するセル数の警告しきい値 */
+    UPROPERTY(Config)
+    int32 MaxCellsPerZoneWarning = 65536;
+};
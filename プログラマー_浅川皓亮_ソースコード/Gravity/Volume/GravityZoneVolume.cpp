@@ -0,0 +1,114 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Object/Gravity/GravityZoneVolume.h"
+#include "Components/BoxComponent.h"
+#include "SubSystem/GravityZoneSubsystem.h"
+
+AGravityZoneVolume::AGravityZoneVolume()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    Bounds = CreateDefaultSubobject<UBoxComponent>(TEXT("Bounds"));
+    RootComponent = Bounds;
+    Bounds->InitBoxExtent(FVector(500.f));
+
+    // 判定はサブシステムのグリッドで行うので衝突は不要
+    Bounds->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Bounds->SetGenerateOverlapEvents(false);
+}
+
+// 処理の流れ:
+// 1. ワールド空間のパラメータをキャッシュ
+// 2. サブシステムに登録
+void AGravityZoneVolume::BeginPlay()
+{
+    Super::BeginPlay();
+
+    CacheWorldParameters();
+
+    if (UGravityZoneSubsystem* Subsystem = GetWorld()->GetSubsystem<UGravityZoneSubsystem>())
+    {
+        Subsystem->RegisterZone(this);
+    }
+}
+
+void AGravityZoneVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UGravityZoneSubsystem* Subsystem = World->GetSubsystem<UGravityZoneSubsystem>())
+        {
+            Subsystem->UnregisterZone(this);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AGravityZoneVolume::CacheWorldParameters()
+{
+    const FTransform& Transform = GetActorTransform();
+    WorldDirection = Transform.TransformVectorNoScale(LocalDirection).GetSafeNormal();
+    WorldCenter = Transform.TransformPosition(RadialCenter);
+
+    if (WorldDirection.IsNearlyZero())
+    {
+        WorldDirection = FVector::DownVector;
+    }
+}
+
+bool AGravityZoneVolume::ContainsPoint(const FVector& Location) const
+{
+    const FVector Local = Bounds->GetComponentTransform().InverseTransformPosition(Location);
+    const FVector Extent = Bounds->GetUnscaledBoxExtent();
+
+    return FMath::Abs(Local.X) <= Extent.X
+        && FMath::Abs(Local.Y) <= Extent.Y
+        && FMath::Abs(Local.Z) <= Extent.Z;
+}
+
+bool AGravityZoneVolume::IntersectsBox(const FBox& Box) const
+{
+    const FBox LocalBox = Box.InverseTransformBy(Bounds->GetComponentTransform());
+    const FVector Extent = Bounds->GetUnscaledBoxExtent();
+
+    return LocalBox.Intersect(FBox(-Extent, Extent));
+}
+
+// 処理の流れ:
+// 1. Directionalはキャッシュ済みの方向を返す
+// 2. Radialは中心への方向（Repelなら逆向き）
+// 3. Blendedは両者をRadialBlendで合成
+FVector AGravityZoneVolume::EvaluateDirection(const FVector& Location) const
+{
+    if (ZoneType == EGravityZoneType::Directional)
+    {
+        return WorldDirection;
+    }
+
+    FVector ToCenter = (WorldCenter - Location).GetSafeNormal();
+    if (bRepel)
+    {
+        ToCenter *= -1.0f;
+    }
+
+    // 中心点上では方向が決まらないので一定方向を使う
+    if (ToCenter.IsNearlyZero())
+    {
+        return WorldDirection;
+    }
+
+    if (ZoneType == EGravityZoneType::Radial)
+    {
+        return ToCenter;
+    }
+
+    const FVector Blended = FMath::Lerp(WorldDirection, ToCenter, RadialBlend).GetSafeNormal();
+    return Blended.IsNearlyZero() ? ToCenter : Blended;
+}
+
+FBox AGravityZoneVolume::GetWorldBounds() const
+{
+    return Bounds->Bounds.GetBox();
+}
@@ -0,0 +1,113 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "GravityZoneVolume.generated.h"
+
+class UBoxComponent;
+
+/**
+ * @brief 重力ゾーンの種類
+ */
+UENUM(BlueprintType)
+enum class EGravityZoneType : uint8
+{
+    Directional UMETA(DisplayName = "Directional"),  // 一定方向
+    Radial      UMETA(DisplayName = "Radial"),       // 中心点へ向かう
+    Blended     UMETA(DisplayName = "Blended")       // 一定方向と中心方向の合成
+};
+
+/**
+ * @brief 重力方向を上書きするゾーン
+ *
+ * オーバーラップイベントは使わず、UGravityZoneSubsystem の空間グリッドに登録して
+ * 位置から引く。配置後に動かさない前提（BeginPlay時の姿勢でグリッドに焼き込む）。
+ */
+UCLASS()
+class CARRY_API AGravityZoneVolume : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AGravityZoneVolume();
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+    /**
+     * @brief 位置がゾーンの範囲内か
+     * @param Location ワールド座標
+     */
+    bool ContainsPoint(const FVector& Location) const;
+
+    /**
+     * @brief ワールド空間の箱と範囲が重なるか（ゾーンのローカル軸で判定するため、回転したゾーンでは多めに重なる）
+     * @param Box ワールド空間のAABB
+     */
+    bool IntersectsBox(const FBox& Box) const;
+
+    /**
+     * @brief 指定位置での重力方向（正規化済み）を返す
+     * @param Location ワールド座標
+     */
+    FVector EvaluateDirection(const FVector& Location) const;
+
+    /** @brief ワールド空間のAABB */
+    FBox GetWorldBounds() const;
+
+    /** @brief 重力の強さの倍率 */
+    float GetGravityScale() const { return GravityScale; }
+
+    /** @brief 重なったゾーンの優先度（大きいほど優先） */
+    int32 GetPriority() const { return Priority; }
+
+private:
+    /** @brief ワールド空間の方向・中心をキャッシュ */
+    void CacheWorldParameters();
+
+private:
+    /** 範囲 */
+    UPROPERTY(VisibleAnywhere, Category = "Gravity")
+    UBoxComponent* Bounds;
+
+    UPROPERTY(EditAnywhere, Category = "Gravity")
+    EGravityZoneType ZoneType = EGravityZoneType::Directional;
+
+    /** 重力方向（アクターのローカル空間） */
+    UPROPERTY(EditAnywhere, Category = "Gravity",
+        meta = (EditCondition = "ZoneType != EGravityZoneType::Radial", EditConditionHides))
+    FVector LocalDirection = FVector::DownVector;
+
+    /** 引力の中心（アクターのローカル空間） */
+    UPROPERTY(EditAnywhere, Category = "Gravity",
+        meta = (EditCondition = "ZoneType != EGravityZoneType::Directional", EditConditionHides))
+    FVector RadialCenter = FVector::ZeroVector;
+
+    /** trueなら中心から外へ押し出す */
+    UPROPERTY(EditAnywhere, Category = "Gravity",
+        meta = (EditCondition = "ZoneType != EGravityZoneType::Directional", EditConditionHides))
+    bool bRepel = false;
+
+    /** 中心方向の割合（0 = 一定方向のみ、1 = 中心方向のみ） */
+    UPROPERTY(EditAnywhere, Category = "Gravity",
+        meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "ZoneType == EGravityZoneType::Blended", EditConditionHides))
+    float RadialBlend = 0.5f;
+
+    /** 重力の強さの倍率 */
+    UPROPERTY(EditAnywhere, Category = "Gravity", meta = (ClampMin = "0.0"))
+    float GravityScale = 1.0f;
+
+    /** 重なったゾーンの優先度 */
+    UPROPERTY(EditAnywhere, Category = "Gravity")
+    int32 Priority = 0;
+
+    /** ワールド空間の重力方向 */
+    FVector WorldDirection = FVector::DownVector;
+
+    /** ワールド空間の引力中心 */
+    FVector WorldCenter = FVector::ZeroVector;
+};
@@ -1,4 +1,5 @@
 #include "Component/PhysicsCalculatorComponent.h"
+#include "SubSystem/TraversalSurfaceSubsystem.h"
 #include "UE5Coro.h"
 
 using namespace UE5Coro;
@@ -22,19 +23,33 @@ void UPhysicsCalculatorComponent::BeginPlay()
 void UPhysicsCalculatorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     StopPhysics();
+
+    if (CachedTraceScheduler.IsValid())
+    {
+        CachedTraceScheduler->CancelRequests(this);
+    }
+    bHasPendingGroundQuery = false;
     Super::EndPlay(EndPlayReason);
 }
 
 // 処理の流れ:
-// 1. Ownerを取得してキャッシュ
+// 1. Owner・重力ゾーン・トレーススケジューラを取得してキャッシュ
+// 2. シミュレーション位置を初期化
 void UPhysicsCalculatorComponent::InitializeComponent()
 {
     CachedOwner = GetOwner();
+    CachedGravitySubsystem = GetWorld()->GetSubsystem<UGravityZoneSubsystem>();
+    CachedTraceScheduler = GetWorld()->GetSubsystem<UTraceSchedulerSubsystem>();
 
     if (!CachedOwner.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("PhysicsCalculator: Owner is invalid"));
+        return;
     }
+
+    CurrentSimulatedLocation = CachedOwner->GetActorLocation();
+    PreviousSimulatedLocation = CurrentSimulatedLocation;
+    LastRenderedLocation = CurrentSimulatedLocation;
 }
 
 // 処理の流れ:
@@ -46,8 +61,12 @@ void UPhysicsCalculatorComponent::StartPhysics()
         return;
     }
 
+    bIsSleeping = false;
+    RestStepCount = 0;
+
     bIsPhysicsActive = true;
     bShouldStopPhysics = false;
+    AccumulatedTime = 0.0f;
     PhysicsUpdateLoop();
 }
 
@@ -60,13 +79,16 @@ void UPhysicsCalculatorComponent::StopPhysics()
 }
 
 // 処理の流れ:
-// 1. 力のパラメータを設定
-// 2. タイマーをリセット
+// 1. スリープ中なら起床
+// 2. 力のパラメータを設定
+// 3. 落下速度をリセット
 void UPhysicsCalculatorComponent::AddForce(FVector Direction, float Force, bool bSweep, bool bLocalOffset)
 {
+    WakeUp();
+
     ForceDirection = Direction;
-    ForceScale = Force;
-    GravityTimer = 0.0f;
+    BodyState.ForceScale = Force;
+    BodyState.FallSpeed = 0.0f;
     bUseSweep = bSweep;
     bUseLocalOffset = bLocalOffset;
 }
@@ -76,58 +98,127 @@ void UPhysicsCalculatorComponent::AddForce(FVector Direction, float Force, bool
 void UPhysicsCalculatorComponent::ResetForce()
 {
     ForceDirection = FVector::ZeroVector;
-    ForceScale = 0.0f;
-    GravityTimer = 0.0f;
+    BodyState.ForceScale = 0.0f;
+    BodyState.FallSpeed = 0.0f;
 }
 
 // 処理の流れ:
 // 1. 重力パラメータを設定
+// 2. 重力が変わったのでスリープを解除
 void UPhysicsCalculatorComponent::SetGravityScale(bool bApplyGravity, float Scale, float Modifier)
 {
+    WakeUp();
+
     bShouldApplyGravity = bApplyGravity;
     GravityScale = Scale;
     GravityDivider = Modifier;
 }
 
+// 処理の流れ:
+// 1. スリープ状態を解除
+// 2. シミュレーション位置をOwnerの現在位置に合わせる
+void UPhysicsCalculatorComponent::WakeUp()
+{
+    RestStepCount = 0;
+
+    if (!bIsSleeping)
+    {
+        return;
+    }
+
+    bIsSleeping = false;
+    AccumulatedTime = 0.0f;
+    ResetSimulatedLocation();
+}
+
 // ============================================
 // Coroutines
 // ============================================
 
 // 処理の流れ:
-// 1. 毎フレーム非同期で接地判定
-// 2. 接地状態に応じて重力または力を適用
-// 3. 停止フラグが立つまで継続
+// 1. スリープ中は起床条件のみ確認（Sweepしない）
+// 2. 補間表示していた位置をシミュレーション位置へ戻す
+// 3. 経過時間をアキュムレータに加算
+// 4. FixedTimeStep ごとに接地判定と積分を行う（上限 MaxStepsPerFrame）
+// 5. 残り時間の割合で表示位置を補間
+// 6. 停止フラグが立つまで継続
 TCoroutine<> UPhysicsCalculatorComponent::PhysicsUpdateLoop()
 {
     while (!bShouldStopPhysics && CachedOwner.IsValid())
     {
         co_await NextTick();
 
-        const float DeltaTime = GetWorld()->GetDeltaSeconds();
+        if (bShouldStopPhysics || !CachedOwner.IsValid())
+        {
+            break;
+        }
+
+        if (bIsSleeping)
+        {
+            bHasJustLanded = false;
+
+            if (!ShouldWakeUp())
+            {
+                continue;
+            }
+
+            WakeUp();
+        }
+
+        RestoreSimulatedLocation();
+
+        AccumulatedTime += GetWorld()->GetDeltaSeconds();
 
-        // 非同期で接地判定
-        bool bNewGroundState = co_await AsyncCheckGroundState();
-        UpdateGroundState(bNewGroundState);
+        bool bLandedThisFrame = false;
+        int32 StepCount = 0;
 
-        // 重力適用
-        if (bShouldApplyGravity && !bIsOnGround)
+        while (AccumulatedTime >= FixedTimeStep && StepCount < MaxStepsPerFrame)
         {
-            ApplyGravity(DeltaTime);
+            // 接地判定に今のステップの重力方向を使うため、先にゾーンを問い合わせる
+            UpdateGravitySample();
+
+            // 非同期で接地判定
+            bool bNewGroundState = co_await AsyncCheckGroundState();
+            UpdateGroundState(bNewGroundState);
+            bLandedThisFrame |= bHasJustLanded;
+
+            StepSimulation(FixedTimeStep);
+            UpdateSleepState();
+
+            AccumulatedTime -= FixedTimeStep;
+            ++StepCount;
+
+            if (bIsSleeping)
+            {
+                break;
+            }
         }
 
-        // 力適用
-        if (ForceScale > 0.0f)
+        // 処理しきれなかった時間は捨てる（ヒッチ時にステップが膨らみ続けるのを防ぐ）
+        if (StepCount >= MaxStepsPerFrame)
         {
-            ApplyForce(DeltaTime);
+            AccumulatedTime = FMath::Min(AccumulatedTime, FixedTimeStep);
         }
+
+        bHasJustLanded = bLandedThisFrame;
+
+        if (bIsSleeping)
+        {
+            // 静止位置にそのまま留める
+            AccumulatedTime = 0.0f;
+            continue;
+        }
+
+        ApplyInterpolatedLocation();
     }
 
     bIsPhysicsActive = false;
 }
 
 // 処理の流れ:
-// 1. 非同期Sweepで接地判定
-// 2. 結果を返す
+// 1. 非同期Sweepで接地判定（スケジューラがあれば予算内でのみ実行）
+// 2. 予算切れなら届いている遅延要求の結果を使い、なければ遅延要求を出して前回の状態を返す
+// 3. 結果を返す
 TCoroutine<bool> UPhysicsCalculatorComponent::AsyncCheckGroundState()
 {
     if (!CachedOwner.IsValid())
@@ -140,7 +231,7 @@ TCoroutine<bool> UPhysicsCalculatorComponent::AsyncCheckGroundState()
     const float HalfHeight = CachedOwner->GetSimpleCollisionHalfHeight();
     const FQuat ActorRotation = CachedOwner->GetActorQuat();
 
-    const FVector DownVector = ActorRotation.GetUpVector() * -1.0f;
+    const FVector DownVector = GetGravityDirection();
     const FVector FootLocation = ActorLocation + DownVector * HalfHeight;
 
     const FVector BoxExtent(
@@ -152,59 +243,199 @@ TCoroutine<bool> UPhysicsCalculatorComponent::AsyncCheckGroundState()
     const FVector StartTrace = FootLocation;
     const FVector EndTrace = FootLocation + DownVector * GroundCheckDistance;
 
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(CachedOwner.Get());
-
     FHitResult Hit;
+    bool bHit = false;
 
-    // 同期Sweepだが、コルーチン内なので他の処理をブロックしない
-    bool bHit = GetWorld()->SweepSingleByChannel(
-        Hit,
-        StartTrace,
-        EndTrace,
-        ActorRotation,
-        ECC_Visibility,
-        FCollisionShape::MakeBox(BoxExtent),
-        Params
-    );
+    if (CachedTraceScheduler.IsValid())
+    {
+        FTraceRequest Request;
+        Request.Start = StartTrace;
+        Request.End = EndTrace;
+        Request.Rotation = ActorRotation;
+        Request.Shape = FCollisionShape::MakeBox(BoxExtent);
+        Request.Channel = ECC_Visibility;
+        Request.Params.AddIgnoredActor(CachedOwner.Get());
+        // 滑る床の判定にヒット位置の物理マテリアルを使う
+        Request.Params.bReturnPhysicalMaterial = true;
+        Request.Priority = GroundTracePriority;
+
+        if (!CachedTraceScheduler->TryExecuteImmediate(Request, Hit, bHit))
+        {
+            // 予算切れ: 前に出した遅延要求の結果が届いていればそれを使う
+            if (bHasDeferredGroundResult)
+            {
+                bHasDeferredGroundResult = false;
+                ApplyGroundHit(bDeferredGroundHit, DeferredGroundHit);
+                co_return bDeferredGroundHit;
+            }
+
+            // まだなら遅延要求を1つだけ出し、届くまでは前回の接地状態を引き継ぐ
+            if (!bHasPendingGroundQuery)
+            {
+                bHasPendingGroundQuery = true;
+                Request.Requester = this;
+                Request.OnCompleted.BindWeakLambda(this, [this](bool bDeferredHit, const FHitResult& DeferredHit)
+                {
+                    bHasPendingGroundQuery = false;
+                    bHasDeferredGroundResult = true;
+                    bDeferredGroundHit = bDeferredHit;
+                    DeferredGroundHit = DeferredHit;
+                });
+                CachedTraceScheduler->Submit(MoveTemp(Request));
+            }
+            co_return bIsOnGround;
+        }
+
+        // 即時実行できたので、届いていた遅延要求の結果は古い
+        bHasDeferredGroundResult = false;
+    }
+    else
+    {
+        FCollisionQueryParams Params;
+        Params.AddIgnoredActor(CachedOwner.Get());
+        Params.bReturnPhysicalMaterial = true;
+
+        // 同期Sweepだが、コルーチン内なので他の処理をブロックしない
+        bHit = GetWorld()->SweepSingleByChannel(
+            Hit,
+            StartTrace,
+            EndTrace,
+            ActorRotation,
+            ECC_Visibility,
+            FCollisionShape::MakeBox(BoxExtent),
+            Params
+        );
+    }
 
+    ApplyGroundHit(bHit, Hit);
     co_return bHit;
 }
 
+void UPhysicsCalculatorComponent::ApplyGroundHit(bool bHit, const FHitResult& Hit)
+{
+    GroundActor = bHit ? Hit.GetActor() : nullptr;
+    bIsGroundSlippery = bHit && EnumHasAnyFlags(
+        UTraversalSurfaceSubsystem::GetFlagsForHit(GetWorld(), Hit), ETraversalFlags::Slippery);
+}
+
+// ============================================
+// Fixed Step Simulation
+// ============================================
+
+// 処理の流れ:
+// 1. 落下速度を加速度で更新し、最大速度で制限
+// 2. 力を減衰
+// 3. 更新後の速度から移動距離を計算（半陰的オイラー）
+FPhysicsCalculatorStepResult UPhysicsCalculatorComponent::IntegrateStep(
+    FPhysicsCalculatorBodyState& State,
+    const FPhysicsCalculatorStepParams& Params,
+    float StepTime)
+{
+    FPhysicsCalculatorStepResult Result;
+
+    if (Params.bApplyGravity)
+    {
+        State.FallSpeed = FMath::Min(State.FallSpeed + Params.GravityAcceleration * StepTime, Params.MaxFallSpeed);
+        Result.FallDistance = State.FallSpeed * StepTime;
+    }
+
+    if (State.ForceScale > 0.0f)
+    {
+        State.ForceScale = FMath::Max(State.ForceScale - Params.ForceDecayRate * StepTime, 0.0f);
+        Result.ForceDistance = State.ForceScale * Params.ForceSpeedScale * StepTime;
+    }
+
+    return Result;
+}
+
+// 処理の流れ:
+// 1. 「1フレームあたりの量」で調整された設定値を基準フレームレートで秒単位に換算
+FPhysicsCalculatorStepParams UPhysicsCalculatorComponent::MakeStepParams() const
+{
+    FPhysicsCalculatorStepParams Params;
+    Params.GravityAcceleration = GravityScale / FMath::Max(GravityDivider, KINDA_SMALL_NUMBER) * ReferenceFrameRate * GravitySample.Scale;
+    Params.MaxFallSpeed = MaxFallingSpeed * ReferenceFrameRate;
+    Params.ForceDecayRate = 10.0f;
+    Params.ForceSpeedScale = ReferenceFrameRate;
+    Params.bApplyGravity = bShouldApplyGravity && !bIsOnGround;
+    return Params;
+}
+
 // 処理の流れ:
-// 1. 重力タイマーを更新
-// 2. 落下速度を計算
-// 3. 最大速度で制限
-// 4. 下方向に移動
-void UPhysicsCalculatorComponent::ApplyGravity(float DeltaTime)
+// 1. 1ステップ分積分（重力ゾーンは接地判定の前に問い合わせ済み）
+// 2. 重力・力による移動を適用
+// 3. ステップ前後の位置から速度を記録
+void UPhysicsCalculatorComponent::StepSimulation(float StepTime)
 {
     if (!CachedOwner.IsValid())
     {
         return;
     }
 
-    GravityTimer += DeltaTime;
+    PreviousSimulatedLocation = CurrentSimulatedLocation;
 
-    float FallSpeed = (GravityScale * GravityTimer) / GravityDivider;
-    FallSpeed = FMath::Min(FallSpeed, MaxFallingSpeed);
+    const FPhysicsCalculatorStepResult Result = IntegrateStep(BodyState, MakeStepParams(), StepTime);
+
+    if (Result.FallDistance > 0.0f)
+    {
+        ApplyGravity(Result.FallDistance);
+    }
 
-    CachedOwner->AddActorLocalOffset(FVector(0, 0, -FallSpeed), true);
+    if (Result.ForceDistance > 0.0f)
+    {
+        ApplyForce(Result.ForceDistance);
+    }
+
+    CurrentSimulatedLocation = CachedOwner->GetActorLocation();
+    SimulatedVelocity = (CurrentSimulatedLocation - PreviousSimulatedLocation) / StepTime;
 }
 
 // 処理の流れ:
-// 1. 力を減衰
-// 2. 移動ベクトルを計算
-// 3. 移動適用
-void UPhysicsCalculatorComponent::ApplyForce(float DeltaTime)
+// 1. 重力ゾーン内ならゾーンの方向に移動
+// 2. それ以外はローカル下方向に移動
+void UPhysicsCalculatorComponent::ApplyGravity(float FallDistance)
 {
-    if (!CachedOwner.IsValid())
+    if (GravitySample.IsInZone())
     {
+        CachedOwner->AddActorWorldOffset(GravitySample.Direction * FallDistance, true);
         return;
     }
 
-    ForceScale = FMath::Max(ForceScale - DeltaTime * 10.0f, 0.0f);
+    CachedOwner->AddActorLocalOffset(FVector(0, 0, -FallDistance), true);
+}
 
-    const FVector MoveVector = ForceDirection * ForceScale;
+// 処理の流れ:
+// 1. ゾーンを使わない設定ならデフォルト（ゾーン外）のまま
+// 2. キャッシュ付きで現在位置のゾーンを問い合わせ
+void UPhysicsCalculatorComponent::UpdateGravitySample()
+{
+    if (!bUseGravityZones || !CachedGravitySubsystem.IsValid())
+    {
+        GravitySample = FGravitySample();
+        return;
+    }
+
+    GravitySample = CachedGravitySubsystem->QueryGravity(CurrentSimulatedLocation, GravityZoneCache);
+}
+
+// 処理の流れ:
+// 1. ゾーン内ならゾーンの方向、それ以外はローカル下方向
+FVector UPhysicsCalculatorComponent::GetGravityDirection() const
+{
+    if (GravitySample.IsInZone())
+    {
+        return GravitySample.Direction;
+    }
+
+    return CachedOwner->GetActorQuat().GetUpVector() * -1.0f;
+}
+
+// 処理の流れ:
+// 1. 移動ベクトルを計算
+// 2. 移動適用
+void UPhysicsCalculatorComponent::ApplyForce(float ForceDistance)
+{
+    const FVector MoveVector = ForceDirection * ForceDistance;
 
     if (bUseLocalOffset)
     {
@@ -216,6 +447,71 @@ void UPhysicsCalculatorComponent::ApplyForce(float DeltaTime)
     }
 }
 
+// 処理の流れ:
+// 1. 補間表示していない場合は何もしない
+// 2. 外部から移動されていればシミュレーション位置をそこに合わせる
+// 3. そうでなければシミュレーション位置へ戻す
+void UPhysicsCalculatorComponent::RestoreSimulatedLocation()
+{
+    const FVector OwnerLocation = CachedOwner->GetActorLocation();
+
+    if (!bInterpolateMotion)
+    {
+        CurrentSimulatedLocation = OwnerLocation;
+        PreviousSimulatedLocation = OwnerLocation;
+        return;
+    }
+
+    if (!OwnerLocation.Equals(LastRenderedLocation, KINDA_SMALL_NUMBER))
+    {
+        // テレポート・巻き戻しなどで動かされた
+        ResetSimulatedLocation();
+        RestStepCount = 0;
+        return;
+    }
+
+    if (!OwnerLocation.Equals(CurrentSimulatedLocation, KINDA_SMALL_NUMBER))
+    {
+        CachedOwner->SetActorLocation(CurrentSimulatedLocation);
+    }
+}
+
+// 処理の流れ:
+// 1. 前回・今回のステップ位置と表示位置をOwnerの現在位置にそろえる
+void UPhysicsCalculatorComponent::ResetSimulatedLocation()
+{
+    if (!CachedOwner.IsValid())
+    {
+        return;
+    }
+
+    CurrentSimulatedLocation = CachedOwner->GetActorLocation();
+    PreviousSimulatedLocation = CurrentSimulatedLocation;
+    LastRenderedLocation = CurrentSimulatedLocation;
+    SimulatedVelocity = FVector::ZeroVector;
+}
+
+// 処理の流れ:
+// 1. 残り時間 / ステップ時間 を補間係数とする
+// 2. 前回と今回のステップ位置を補間して反映
+void UPhysicsCalculatorComponent::ApplyInterpolatedLocation()
+{
+    if (!bInterpolateMotion)
+    {
+        return;
+    }
+
+    const float Alpha = FMath::Clamp(AccumulatedTime / FixedTimeStep, 0.0f, 1.0f);
+    const FVector RenderLocation = FMath::Lerp(PreviousSimulatedLocation, CurrentSimulatedLocation, Alpha);
+
+    if (!RenderLocation.Equals(CachedOwner->GetActorLocation(), KINDA_SMALL_NUMBER))
+    {
+        CachedOwner->SetActorLocation(RenderLocation);
+    }
+
+    LastRenderedLocation = CachedOwner->GetActorLocation();
+}
+
 // 処理の流れ:
 // 1. 着地判定
 // 2. 接地時は重力タイマーをリセット
@@ -226,10 +522,92 @@ void UPhysicsCalculatorComponent::UpdateGroundState(bool bNewGroundState)
 
     if (bHasJustLanded)
     {
-        GravityTimer = 0.0f;
+        BodyState.FallSpeed = 0.0f;
         UE_LOG(LogTemp, Log, TEXT("PhysicsCalculator: Landed"));
     }
 
     bIsOnGround = bNewGroundState;
     bWasOnGround = bNewGroundState;
 }
+
+// ============================================
+// Sleep
+// ============================================
+
+// 処理の流れ:
+// 1. 接地・力なし・移動なしなら静止ステップを加算、それ以外はリセット
+// 2. 閾値に達したらスリープ
+void UPhysicsCalculatorComponent::UpdateSleepState()
+{
+    if (!bAllowSleep)
+    {
+        return;
+    }
+
+    // 滑る面の上では静止扱いにしない
+    const bool bAtRest =
+        bIsOnGround &&
+        !bIsGroundSlippery &&
+        BodyState.ForceScale <= 0.0f &&
+        CurrentSimulatedLocation.Equals(PreviousSimulatedLocation, KINDA_SMALL_NUMBER);
+
+    RestStepCount = bAtRest ? RestStepCount + 1 : 0;
+
+    if (RestStepCount >= SleepStepThreshold)
+    {
+        EnterSleep();
+    }
+}
+
+// 処理の流れ:
+// 1. 表示位置を静止位置にそろえる
+// 2. Ownerと足場アクターの姿勢を記録
+void UPhysicsCalculatorComponent::EnterSleep()
+{
+    bIsSleeping = true;
+    RestStepCount = 0;
+    SimulatedVelocity = FVector::ZeroVector;
+
+    PreviousSimulatedLocation = CurrentSimulatedLocation;
+    LastRenderedLocation = CurrentSimulatedLocation;
+    SleepOwnerTransform = CachedOwner->GetActorTransform();
+
+    bHadGroundActorOnSleep = GroundActor.IsValid();
+    if (bHadGroundActorOnSleep)
+    {
+        SleepGroundTransform = GroundActor->GetActorTransform();
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("PhysicsCalculator: Sleep (%s)"), *CachedOwner->GetName());
+}
+
+// 処理の流れ:
+// 1. Ownerが移動・回転していれば起床
+// 2. 重力ゾーンが追加・削除されていれば起床
+// 3. 足場アクターが破棄されていれば起床
+// 4. 足場アクターが移動・回転していれば起床
+bool UPhysicsCalculatorComponent::ShouldWakeUp() const
+{
+    if (!CachedOwner->GetActorTransform().Equals(SleepOwnerTransform, KINDA_SMALL_NUMBER))
+    {
+        return true;
+    }
+
+    if (bUseGravityZones && CachedGravitySubsystem.IsValid() &&
+        CachedGravitySubsystem->GetGridVersion() != GravityZoneCache.GridVersion)
+    {
+        return true;
+    }
+
+    if (!bHadGroundActorOnSleep)
+    {
+        return false;
+    }
+
+    if (!GroundActor.IsValid())
+    {
+        return true;
+    }
+
+    return !GroundActor->GetActorTransform().Equals(SleepGroundTransform, KINDA_SMALL_NUMBER);
+}
@@ -3,10 +3,61 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "UE5Coro.h"
+#include "SubSystem/GravityZoneSubsystem.h"
+#include "SubSystem/TraceSchedulerSubsystem.h"
 #include "PhysicsCalculatorComponent.generated.h"
 
 class UBoxComponent;
 using namespace UE5Coro;
+
+/**
+ * @brief 固定ステップ積分で扱う1ボディ分の速度状態
+ *
+ * UObjectに依存しない値型。積分処理（IntegrateStep）はこの構造体と
+ * FPhysicsCalculatorStepParams のみを参照するため、複数ボディをまとめて処理できる。
+ */
+struct FPhysicsCalculatorBodyState
+{
+    /** @brief ローカル下方向への落下速度（uu/s） */
+    float FallSpeed = 0.0f;
+
+    /** @brief 力の大きさ（AddForceで与えた値。時間で線形減衰） */
+    float ForceScale = 0.0f;
+};
+
+/**
+ * @brief 固定ステップ積分のパラメータ（秒単位に換算済み）
+ */
+struct FPhysicsCalculatorStepParams
+{
+    /** @brief 重力加速度（uu/s^2） */
+    float GravityAcceleration = 0.0f;
+
+    /** @brief 最大落下速度（uu/s） */
+    float MaxFallSpeed = 0.0f;
+
+    /** @brief ForceScale の減衰量（1秒あたり） */
+    float ForceDecayRate = 10.0f;
+
+    /** @brief ForceScale 1あたりの移動速度（uu/s） */
+    float ForceSpeedScale = 1.0f;
+
+    /** @brief 重力を適用するか */
+    bool bApplyGravity = false;
+};
+
+/**
+ * @brief 1ステップ分の積分結果（移動距離）
+ */
+struct FPhysicsCalculatorStepResult
+{
+    /** @brief ローカル下方向への移動距離 */
+    float FallDistance = 0.0f;
+
+    /** @brief 力の方向への移動距離 */
+    float ForceDistance = 0.0f;
+};
+
 /**
  * @brief 簡易物理演算コンポーネント（非同期最適化版）
  *
@@ -18,6 +69,19 @@ using namespace UE5Coro;
  * - Tick依存を排除
  * - キャッシュの活用
  * - 不要な計算の削減
+ *
+ * **固定ステップ積分**
+ * - 経過時間をアキュムレータに貯め、FixedTimeStep 単位で半陰的オイラー積分
+ * - フレームレートに依存せず同じ軌道になる（30fps / 240fps で同一）
+ * - 表示位置は直前2ステップの間を補間して滑らかにする
+ *
+ * **スリープ**
+ * - 力がなく静止したまま接地し続けると、Sweepを止めてスリープする
+ * - AddForce / Ownerの移動 / 足場アクターの移動・破棄で起床する
+ *
+ * **重力ゾーン**
+ * - 重力ゾーン内ではローカル -Z ではなくゾーンの重力方向・倍率を使う
+ * - 問い合わせはセル単位のキャッシュ付き（UGravityZoneSubsystem）
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class CARRY_API UPhysicsCalculatorComponent : public UActorComponent
@@ -76,6 +140,24 @@ public:
     UFUNCTION(BlueprintPure, Category = "Physics")
     bool HasJustLanded() const { return bHasJustLanded; }
 
+    /**
+     * @brief 直近ステップでの移動速度（ワールド空間, uu/s）
+     */
+    UFUNCTION(BlueprintPure, Category = "Physics")
+    FVector GetVelocity() const { return SimulatedVelocity; }
+
+    /**
+     * @brief スリープ中か（接地判定・積分を停止中）
+     */
+    UFUNCTION(BlueprintPure, Category = "Physics")
+    bool IsSleeping() const { return bIsSleeping; }
+
+    /**
+     * @brief スリープを解除して物理計算を再開
+     */
+    UFUNCTION(BlueprintCallable, Category = "Physics")
+    void WakeUp();
+
     /**
      * @brief 重力設定
      */
@@ -99,15 +181,55 @@ private:
     /** @brief 非同期衝突チェック */
     TCoroutine<FVector> AsyncGetBlockedAdjustedVector(const FVector& MoveVector);
 
+    /**
+     * @brief 1ボディを1ステップ分積分する（半陰的オイラー）
+     * @details 速度を先に更新し、更新後の速度で移動距離を求める。
+     *          UObjectに触れないため、多数のボディに対して連続で呼び出せる。
+     */
+    static FPhysicsCalculatorStepResult IntegrateStep(FPhysicsCalculatorBodyState& State, const FPhysicsCalculatorStepParams& Params, float StepTime);
+
+    /** @brief 現在の設定から積分パラメータを作成 */
+    FPhysicsCalculatorStepParams MakeStepParams() const;
+
+    /** @brief 固定ステップを1回進める */
+    void StepSimulation(float StepTime);
+
     /** @brief 重力適用 */
-    void ApplyGravity(float DeltaTime);
+    void ApplyGravity(float FallDistance);
 
     /** @brief 力を適用 */
-    void ApplyForce(float DeltaTime);
+    void ApplyForce(float ForceDistance);
+
+    /** @brief 補間表示していたOwnerをシミュレーション位置へ戻す */
+    void RestoreSimulatedLocation();
+
+    /** @brief ステップ間を補間した位置をOwnerに反映 */
+    void ApplyInterpolatedLocation();
 
     /** @brief 接地状態を更新 */
     void UpdateGroundState(bool bNewGroundState);
 
+    /** @brief 接地判定のヒットから足場アクターと滑る面かを記録 */
+    void ApplyGroundHit(bool bHit, const FHitResult& Hit);
+
+    /** @brief 現在位置の重力ゾーンを問い合わせる */
+    void UpdateGravitySample();
+
+    /** @brief 現在の重力方向（ワールド空間） */
+    FVector GetGravityDirection() const;
+
+    /** @brief ステップ後に静止判定を行い、条件を満たせばスリープ */
+    void UpdateSleepState();
+
+    /** @brief スリープ状態に入る（Owner・足場の姿勢を記録） */
+    void EnterSleep();
+
+    /** @brief スリープ中に起床条件を満たしたか */
+    bool ShouldWakeUp() const;
+
+    /** @brief シミュレーション位置をOwnerの現在位置に合わせる */
+    void ResetSimulatedLocation();
+
 private:
     // ============================================
     // Settings
@@ -131,6 +253,41 @@ private:
     UPROPERTY(EditAnywhere, Category = "Physics|Detection")
     float GroundCheckDistance = 5.0f;
 
+    /** @brief 接地判定Sweepの優先度（予算切れのステップは遅延要求を出し、結果が届くまで前回の接地状態を使う） */
+    UPROPERTY(EditAnywhere, Category = "Physics|Detection")
+    ETracePriority GroundTracePriority = ETracePriority::Normal;
+
+    /** @brief 固定ステップの時間（秒） */
+    UPROPERTY(EditAnywhere, Category = "Physics|Simulation", meta = (ClampMin = "0.001", ClampMax = "0.1"))
+    float FixedTimeStep = 1.0f / 60.0f;
+
+    /** @brief 1フレームで処理する最大ステップ数（超過分は切り捨て） */
+    UPROPERTY(EditAnywhere, Category = "Physics|Simulation", meta = (ClampMin = "1", ClampMax = "16"))
+    int32 MaxStepsPerFrame = 8;
+
+    /**
+     * @brief GravityScale / MaxFallingSpeed / AddForce の値を調整した基準フレームレート
+     * @details 既存の「1フレームあたりの移動量」を秒単位に換算するために使用
+     */
+    UPROPERTY(EditAnywhere, Category = "Physics|Simulation", meta = (ClampMin = "1.0"))
+    float ReferenceFrameRate = 60.0f;
+
+    /** @brief ステップ間の表示位置を補間するか */
+    UPROPERTY(EditAnywhere, Category = "Physics|Simulation")
+    bool bInterpolateMotion = true;
+
+    /** @brief 重力ゾーンの方向・倍率を使うか */
+    UPROPERTY(EditAnywhere, Category = "Physics|Gravity")
+    bool bUseGravityZones = true;
+
+    /** @brief 静止中にスリープさせるか */
+    UPROPERTY(EditAnywhere, Category = "Physics|Sleep")
+    bool bAllowSleep = true;
+
+    /** @brief スリープに入るまでの連続静止ステップ数 */
+    UPROPERTY(EditAnywhere, Category = "Physics|Sleep", meta = (ClampMin = "1", EditCondition = "bAllowSleep"))
+    int32 SleepStepThreshold = 30;
+
 private:
     // ============================================
     // Cached References
@@ -139,6 +296,12 @@ private:
     UPROPERTY()
     TWeakObjectPtr<AActor> CachedOwner;
 
+    UPROPERTY()
+    TWeakObjectPtr<UGravityZoneSubsystem> CachedGravitySubsystem;
+
+    UPROPERTY()
+    TWeakObjectPtr<UTraceSchedulerSubsystem> CachedTraceScheduler;
+
 private:
     // ============================================
     // Runtime State
@@ -147,11 +310,60 @@ private:
     /** @brief 力の方向 */
     FVector ForceDirection = FVector::ZeroVector;
 
-    /** @brief 力の大きさ */
-    float ForceScale = 0.0f;
+    /** @brief 速度状態（落下速度・力の大きさ） */
+    FPhysicsCalculatorBodyState BodyState;
+
+    /** @brief 未処理の経過時間（固定ステップのアキュムレータ） */
+    float AccumulatedTime = 0.0f;
+
+    /** @brief 1つ前のステップ終了時の位置 */
+    FVector PreviousSimulatedLocation = FVector::ZeroVector;
+
+    /** @brief 最新ステップ終了時の位置 */
+    FVector CurrentSimulatedLocation = FVector::ZeroVector;
+
+    /** @brief 補間して最後にOwnerへ反映した位置 */
+    FVector LastRenderedLocation = FVector::ZeroVector;
+
+    /** @brief 直近ステップでの移動速度 */
+    FVector SimulatedVelocity = FVector::ZeroVector;
+
+    /** @brief 重力ゾーン問い合わせキャッシュ */
+    FGravityZoneCache GravityZoneCache;
+
+    /** @brief 現在位置の重力（ゾーン外はデフォルト） */
+    FGravitySample GravitySample;
+
+    /** @brief 最後の接地判定でヒットした足場アクター */
+    TWeakObjectPtr<AActor> GroundActor;
+
+    /** @brief 足場が滑る面か（ETraversalFlags::Slippery） */
+    bool bIsGroundSlippery = false;
+
+    /** @brief 予算切れで出した接地判定の遅延要求が待機中か */
+    bool bHasPendingGroundQuery = false;
+
+    /** @brief 遅延要求の結果が届いていて、次のステップで使えるか */
+    bool bHasDeferredGroundResult = false;
+
+    /** @brief 届いた遅延要求の結果 */
+    bool bDeferredGroundHit = false;
+    FHitResult DeferredGroundHit;
+
+    /** @brief 連続で静止していたステップ数 */
+    int32 RestStepCount = 0;
+
+    /** @brief スリープ中か */
+    bool bIsSleeping = false;
+
+    /** @brief スリープ開始時に足場アクターが存在したか */
+    bool bHadGroundActorOnSleep = false;
+
+    /** @brief スリープ開始時のOwner姿勢 */
+    FTransform SleepOwnerTransform;
 
-    /** @brief 重力タイマー */
-    float GravityTimer = 0.0f;
+    /** @brief スリープ開始時の足場アクター姿勢 */
+    FTransform SleepGroundTransform;
 
     /** @brief 重力修正係数 */
     float GravityDivider = 1.0f;
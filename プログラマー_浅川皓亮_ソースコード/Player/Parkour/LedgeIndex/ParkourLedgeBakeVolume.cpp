@@ -0,0 +1,319 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Object/Parkour/ParkourLedgeBakeVolume.h"
+#include "Object/Parkour/ParkourLedgeIndex.h"
+#include "SubSystem/TraversalSurfaceSubsystem.h"
+#include "Components/BoxComponent.h"
+#include "Engine/World.h"
+
+AParkourLedgeBakeVolume::AParkourLedgeBakeVolume()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    Bounds = CreateDefaultSubobject<UBoxComponent>(TEXT("Bounds"));
+    RootComponent = Bounds;
+    Bounds->InitBoxExtent(FVector(1000.f));
+
+    // 範囲指定のためだけに使う
+    Bounds->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Bounds->SetGenerateOverlapEvents(false);
+}
+
+#if WITH_EDITOR
+namespace
+{
+    /** 同じ縁のサンプルをまとめるキー */
+    struct FLedgeKey
+    {
+        TWeakObjectPtr<UPrimitiveComponent> Component;
+        FIntVector QuantizedNormal;
+        int32 QuantizedDistance = 0;
+        int32 QuantizedTop = 0;
+
+        bool operator==(const FLedgeKey& Other) const
+        {
+            return Component == Other.Component
+                && QuantizedNormal == Other.QuantizedNormal
+                && QuantizedDistance == Other.QuantizedDistance
+                && QuantizedTop == Other.QuantizedTop;
+        }
+
+        friend uint32 GetTypeHash(const FLedgeKey& Key)
+        {
+            return HashCombine(HashCombine(GetTypeHash(Key.Component), GetTypeHash(Key.QuantizedNormal)),
+                HashCombine(GetTypeHash(Key.QuantizedDistance), GetTypeHash(Key.QuantizedTop)));
+        }
+    };
+
+    /** 縁上の1サンプル */
+    struct FLedgeSample
+    {
+        FVector Point = FVector::ZeroVector;
+        float TopZ = 0.0f;
+        float Clearance = 0.0f;
+        float InnerDrop = 0.0f;
+        bool bHasInner = false;
+        AActor* Actor = nullptr;
+    };
+
+    /** 縁ごとの集計 */
+    struct FLedgeAccumulator
+    {
+        FVector NormalSum = FVector::ZeroVector;
+        TArray<FLedgeSample> Samples;
+    };
+
+    /**
+     * @brief 上から下へのマルチトレースで、最も低い面と頭上の空きを求める
+     * @details UParkourComponent::TraceLedgeColumn と同じ規則
+     */
+    bool TraceColumn(UWorld* World, const FVector& Location, float Height, const FCollisionQueryParams& Params,
+        TArray<FHitResult>& Hits, float& OutTopZ, float& OutClearance)
+    {
+        const FVector Start = Location + FVector(0, 0, Height);
+
+        Hits.Reset();
+        World->LineTraceMultiByObjectType(Hits, Start, Location,
+            FCollisionObjectQueryParams(ECC_WorldStatic), Params);
+
+        const int32 TopIndex = Hits.Num() - 1;
+        if (TopIndex < 0 || Hits[TopIndex].bStartPenetrating)
+        {
+            return false;
+        }
+
+        OutTopZ = Hits[TopIndex].Location.Z;
+        OutClearance = Start.Z - OutTopZ;
+
+        if (TopIndex > 0)
+        {
+            if (Hits[TopIndex - 1].bStartPenetrating)
+            {
+                OutClearance = 0.0f;
+            }
+            else
+            {
+                // 上の障害物の下面までを測るため、上端から上向きにトレース
+                const FVector TopLocation(Location.X, Location.Y, OutTopZ);
+                FHitResult CeilingHit;
+                if (World->LineTraceSingleByObjectType(CeilingHit, TopLocation + FVector(0, 0, 1.0f), Start,
+                    FCollisionObjectQueryParams(ECC_WorldStatic), Params))
+                {
+                    OutClearance = CeilingHit.bStartPenetrating ? 0.0f : CeilingHit.Location.Z - OutTopZ;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+// 処理の流れ:
+// 1. 範囲内を格子状にサンプリングし、水平8方向へ静的ジオメトリのみをトレース
+// 2. 壁に当たったら、内側の手前・奥で下向きに上端を調べる
+// 3. コンポーネント・法線・平面距離・上端の高さでまとめる
+// 4. 縁ごとにサンプルを壁に沿って並べ、隙間で区切った区間ごとに線分を作る
+// 5. インデックスへ保存しグリッドを構築
+void AParkourLedgeBakeVolume::BakeLedges()
+{
+    UWorld* World = GetWorld();
+    if (!World || !TargetIndex)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ParkourLedgeBakeVolume: TargetIndex is not set"));
+        return;
+    }
+
+    const FBox Box = Bounds->Bounds.GetBox();
+    const float MinWallCos = FMath::Cos(FMath::DegreesToRadians(MinWallAngle));
+    const float NormalQuantize = FMath::Sin(FMath::DegreesToRadians(NormalQuantizeDegrees));
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(ParkourLedgeBake), false, this);
+    Params.MobilityType = EQueryMobilityType::Static;
+    Params.bReturnPhysicalMaterial = true;
+
+    const FCollisionObjectQueryParams ObjectParams(ECC_WorldStatic);
+
+    static constexpr int32 DirectionCount = 8;
+    FVector Directions[DirectionCount];
+    for (int32 i = 0; i < DirectionCount; ++i)
+    {
+        const float Angle = 2.0f * PI * i / DirectionCount;
+        Directions[i] = FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f);
+    }
+
+    // ========================================
+    // サンプリング
+    // ========================================
+    TMap<FLedgeKey, FLedgeAccumulator> Ledges;
+    TArray<FHitResult> ColumnHits;
+    FHitResult Hit;
+
+    for (float Z = Box.Min.Z; Z <= Box.Max.Z; Z += SampleSpacing)
+    {
+        for (float Y = Box.Min.Y; Y <= Box.Max.Y; Y += SampleSpacing)
+        {
+            for (float X = Box.Min.X; X <= Box.Max.X; X += SampleSpacing)
+            {
+                const FVector Start(X, Y, Z);
+
+                for (const FVector& Direction : Directions)
+                {
+                    if (!World->LineTraceSingleByObjectType(Hit, Start, Start + Direction * TraceLength, ObjectParams, Params)
+                        || Hit.bStartPenetrating)
+                    {
+                        continue;
+                    }
+
+                    UPrimitiveComponent* HitComponent = Hit.GetComponent();
+                    if (!HitComponent
+                        || EnumHasAnyFlags(UTraversalSurfaceSubsystem::GetFlagsForHit(World, Hit), ETraversalFlags::NoParkour))
+                    {
+                        continue;
+                    }
+
+                    // 垂直に近い面のみ
+                    const FVector Normal = FVector(Hit.ImpactNormal.X, Hit.ImpactNormal.Y, 0.0f).GetSafeNormal();
+                    if (FMath::Abs(Hit.ImpactNormal.Z) > MinWallCos || Normal.IsNearlyZero())
+                    {
+                        continue;
+                    }
+
+                    float TopZ = 0.0f;
+                    float Clearance = 0.0f;
+                    if (!TraceColumn(World, Hit.ImpactPoint - Normal * 10.0f, MaxLedgeHeight, Params, ColumnHits, TopZ, Clearance))
+                    {
+                        continue;
+                    }
+
+                    float InnerTopZ = 0.0f;
+                    float InnerClearance = 0.0f;
+                    const bool bHasInner = TraceColumn(World, Hit.ImpactPoint - Normal * 50.0f, MaxLedgeHeight, Params, ColumnHits, InnerTopZ, InnerClearance);
+
+                    FLedgeKey Key;
+                    Key.Component = HitComponent;
+                    Key.QuantizedNormal = FIntVector(
+                        FMath::RoundToInt(Normal.X / NormalQuantize),
+                        FMath::RoundToInt(Normal.Y / NormalQuantize),
+                        0);
+                    Key.QuantizedDistance = FMath::RoundToInt(FVector::DotProduct(Hit.ImpactPoint, Normal) / QuantizeDistance);
+                    Key.QuantizedTop = FMath::RoundToInt(TopZ / QuantizeDistance);
+
+                    FLedgeSample Sample;
+                    Sample.Point = Hit.ImpactPoint;
+                    Sample.TopZ = TopZ;
+                    Sample.Clearance = Clearance;
+                    Sample.bHasInner = bHasInner;
+                    Sample.InnerDrop = bHasInner ? TopZ - InnerTopZ : 0.0f;
+                    Sample.Actor = Hit.GetActor();
+
+                    FLedgeAccumulator& Ledge = Ledges.FindOrAdd(Key);
+                    Ledge.NormalSum += Normal;
+                    Ledge.Samples.Add(Sample);
+                }
+            }
+        }
+    }
+
+    // ========================================
+    // 縁ごとに線分化
+    // ========================================
+    TArray<FParkourLedgeSegment> Segments;
+    TArray<TSoftObjectPtr<AActor>> SourceActors;
+    TMap<AActor*, int32> ActorToIndex;
+
+    // 斜めの壁ではヒットの間隔が最大でサンプル間隔の√2倍になるので、それより広い隙間で区切る
+    const float MaxGap = SampleSpacing * UE_SQRT_2;
+    TArray<TPair<float, int32>> SortedSamples;
+
+    for (const TPair<FLedgeKey, FLedgeAccumulator>& Pair : Ledges)
+    {
+        const FLedgeAccumulator& Ledge = Pair.Value;
+        const FVector Normal = Ledge.NormalSum.GetSafeNormal();
+        if (Normal.IsNearlyZero() || Ledge.Samples.Num() == 0)
+        {
+            continue;
+        }
+
+        const FVector Tangent = FVector::CrossProduct(FVector::UpVector, Normal);
+
+        // 壁に沿った位置で並べる
+        SortedSamples.Reset();
+        for (int32 SampleIndex = 0; SampleIndex < Ledge.Samples.Num(); ++SampleIndex)
+        {
+            SortedSamples.Emplace(FVector::DotProduct(Ledge.Samples[SampleIndex].Point, Tangent), SampleIndex);
+        }
+        SortedSamples.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+
+        int32 RunStart = 0;
+        for (int32 Current = 1; Current <= SortedSamples.Num(); ++Current)
+        {
+            // 隙間・末尾で区間を閉じる
+            if (Current < SortedSamples.Num() && SortedSamples[Current].Key - SortedSamples[Current - 1].Key <= MaxGap)
+            {
+                continue;
+            }
+
+            float PlaneDistance = 0.0f;
+            float TopZSum = 0.0f;
+            float BottomZ = TNumericLimits<float>::Max();
+            float Clearance = TNumericLimits<float>::Max();
+            float InnerDropSum = 0.0f;
+            int32 InnerCount = 0;
+            AActor* Actor = nullptr;
+
+            for (int32 RunIndex = RunStart; RunIndex < Current; ++RunIndex)
+            {
+                const FLedgeSample& Sample = Ledge.Samples[SortedSamples[RunIndex].Value];
+                PlaneDistance += FVector::DotProduct(Sample.Point, Normal);
+                TopZSum += Sample.TopZ;
+                BottomZ = FMath::Min(BottomZ, Sample.Point.Z);
+                Clearance = FMath::Min(Clearance, Sample.Clearance);
+                Actor = Sample.Actor;
+
+                if (Sample.bHasInner)
+                {
+                    InnerDropSum += Sample.InnerDrop;
+                    ++InnerCount;
+                }
+            }
+
+            const int32 RunCount = Current - RunStart;
+            PlaneDistance /= RunCount;
+
+            // サンプル間隔の半分だけ広げて、端のサンプル間を埋める
+            const FVector Base = Normal * PlaneDistance + FVector(0, 0, TopZSum / RunCount);
+            const float Padding = SampleSpacing * 0.5f;
+
+            FParkourLedgeSegment Segment;
+            Segment.Start = Base + Tangent * (SortedSamples[RunStart].Key - Padding);
+            Segment.End = Base + Tangent * (SortedSamples[Current - 1].Key + Padding);
+            Segment.Normal = FVector3f(Normal);
+            Segment.BottomZ = BottomZ - Padding;
+            Segment.Clearance = Clearance;
+            Segment.bHasInnerSurface = InnerCount > 0;
+            Segment.InnerDrop = Segment.bHasInnerSurface ? InnerDropSum / InnerCount : 0.0f;
+
+            if (Actor)
+            {
+                if (const int32* Found = ActorToIndex.Find(Actor))
+                {
+                    Segment.ActorIndex = *Found;
+                }
+                else
+                {
+                    Segment.ActorIndex = SourceActors.Add(Actor);
+                    ActorToIndex.Add(Actor, Segment.ActorIndex);
+                }
+            }
+
+            Segments.Add(Segment);
+            RunStart = Current;
+        }
+    }
+
+    // ========================================
+    // 保存
+    // ========================================
+    TargetIndex->Build(MoveTemp(Segments), MoveTemp(SourceActors), Box, CellSize);
+}
+#endif
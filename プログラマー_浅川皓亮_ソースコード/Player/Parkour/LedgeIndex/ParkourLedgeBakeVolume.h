@@ -0,0 +1,74 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ParkourLedgeBakeVolume.generated.h"
+
+class UBoxComponent;
+class UParkourLedgeIndex;
+
+/**
+ * @brief 乗り越え・登り可能な縁を UParkourLedgeIndex に焼き込む範囲
+ *
+ * エディタの「Bake Ledges」で範囲内の静的ジオメトリをトレースし、
+ * 壁ごとに上端の高さ・奥行き・頭上の空きを求め、隙間で区切った線分にまとめる。
+ * 実行時は UParkourComponent がこの範囲内でインデックスを優先して使う。
+ */
+UCLASS()
+class CARRY_API AParkourLedgeBakeVolume : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AParkourLedgeBakeVolume();
+
+    /** @brief 焼き込み先のインデックス */
+    UParkourLedgeIndex* GetLedgeIndex() const { return TargetIndex; }
+
+#if WITH_EDITOR
+    /**
+     * @brief 範囲内の縁を焼き込む
+     */
+    UFUNCTION(CallInEditor, Category = "Parkour")
+    void BakeLedges();
+#endif
+
+private:
+    /** 範囲 */
+    UPROPERTY(VisibleAnywhere, Category = "Parkour")
+    UBoxComponent* Bounds;
+
+    /** 焼き込み先 */
+    UPROPERTY(EditAnywhere, Category = "Parkour")
+    UParkourLedgeIndex* TargetIndex;
+
+    /** サンプリング間隔 */
+    UPROPERTY(EditAnywhere, Category = "Parkour", meta = (ClampMin = "10.0"))
+    float SampleSpacing = 50.0f;
+
+    /** 各サンプル点からの水平トレース距離 */
+    UPROPERTY(EditAnywhere, Category = "Parkour", meta = (ClampMin = "10.0"))
+    float TraceLength = 100.0f;
+
+    /** 壁の接触位置から上端までの最大の高さ（UParkourComponent の MaxDetectionHeight に合わせる） */
+    UPROPERTY(EditAnywhere, Category = "Parkour", meta = (ClampMin = "10.0"))
+    float MaxLedgeHeight = 500.0f;
+
+    /** 壁とみなす最小角度（水平面からの角度） */
+    UPROPERTY(EditAnywhere, Category = "Parkour", meta = (ClampMin = "0.0", ClampMax = "90.0"))
+    float MinWallAngle = 70.0f;
+
+    /** 同一の縁とみなす量子化単位（平面距離・上端の高さ） */
+    UPROPERTY(EditAnywhere, Category = "Parkour", meta = (ClampMin = "1.0"))
+    float QuantizeDistance = 10.0f;
+
+    /** 同一の縁とみなす法線の量子化単位（度） */
+    UPROPERTY(EditAnywhere, Category = "Parkour", meta = (ClampMin = "1.0"))
+    float NormalQuantizeDegrees = 5.0f;
+
+    /** インデックスのセルサイズ */
+    UPROPERTY(EditAnywhere, Category = "Parkour", meta = (ClampMin = "50.0"))
+    float CellSize = 400.0f;
+};
@@ -0,0 +1,33 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Object/Parkour/ParkourLedgeIndex.h"
+
+void UParkourLedgeIndex::ForEachSegmentNear(const FVector& Location, float Radius,
+    TFunctionRef<void(int32 SegmentIndex, const FParkourLedgeSegment& Segment)> Visitor) const
+{
+    Grid.ForEachElementNear(Segments, Location, Radius, Visitor);
+}
+
+#if WITH_EDITOR
+// 処理の流れ:
+// 1. 縁を保存
+// 2. 各縁の線分を包むXY範囲でグリッドを構築
+void UParkourLedgeIndex::Build(TArray<FParkourLedgeSegment>&& InSegments, TArray<TSoftObjectPtr<AActor>>&& InSourceActors,
+    const FBox& InBounds, float InCellSize)
+{
+    Segments = MoveTemp(InSegments);
+    SourceActors = MoveTemp(InSourceActors);
+
+    Grid.Build(Segments, [](const FParkourLedgeSegment& Segment)
+        {
+            return FBox(Segment.Start.ComponentMin(Segment.End), Segment.Start.ComponentMax(Segment.End));
+        }, InBounds, InCellSize);
+
+    MarkPackageDirty();
+
+    const FIntPoint GridSize = Grid.GetGridSize();
+    UE_LOG(LogTemp, Log, TEXT("ParkourLedgeIndex: Built %d ledges in %dx%d cells"),
+        Segments.Num(), GridSize.X, GridSize.Y);
+}
+#endif
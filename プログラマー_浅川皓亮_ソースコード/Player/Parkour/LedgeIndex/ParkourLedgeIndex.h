@@ -0,0 +1,100 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Object/Traversal/TraversalCellGrid.h"
+#include "ParkourLedgeIndex.generated.h"
+
+/**
+ * @brief 焼き込み済みの縁（壁の上端に沿った線分）
+ */
+USTRUCT()
+struct FParkourLedgeSegment
+{
+    GENERATED_BODY()
+
+    /** 上端の線分の始点・終点（壁面上、Zは上端の高さ） */
+    UPROPERTY()
+    FVector Start = FVector::ZeroVector;
+
+    UPROPERTY()
+    FVector End = FVector::ZeroVector;
+
+    /** 壁面の法線（外向き・水平） */
+    UPROPERTY()
+    FVector3f Normal = FVector3f::ZeroVector;
+
+    /** 壁の手前の床の高さ */
+    UPROPERTY()
+    float BottomZ = 0.0f;
+
+    /** 上端から奥（内側の上端）までの高さの差 */
+    UPROPERTY()
+    float InnerDrop = 0.0f;
+
+    /** 上端から頭上の次の面までの高さ */
+    UPROPERTY()
+    float Clearance = 0.0f;
+
+    /** 奥に上端があったか（厚さは実行時に UParkourComponent の ThicknessThreshold で判定する） */
+    UPROPERTY()
+    bool bHasInnerSurface = false;
+
+    /** 元になったアクター（SourceActors のインデックス） */
+    UPROPERTY()
+    int32 ActorIndex = INDEX_NONE;
+};
+
+/**
+ * @brief 乗り越え・登り可能な縁を焼き込んだ空間インデックス
+ *
+ * エディタで AParkourLedgeBakeVolume から生成する。
+ * 線分は FTraversalCellGrid（XY平面の一様グリッド）に登録する。
+ */
+UCLASS(BlueprintType)
+class CARRY_API UParkourLedgeIndex : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief 位置の周囲にある縁を列挙（複数セルにまたがる縁は重複して渡ることがある）
+     * @param Location 問い合わせ位置
+     * @param Radius 問い合わせ半径
+     * @param Visitor 縁ごとに呼ばれる
+     */
+    void ForEachSegmentNear(const FVector& Location, float Radius,
+        TFunctionRef<void(int32 SegmentIndex, const FParkourLedgeSegment& Segment)> Visitor) const;
+
+    /** @brief 位置が焼き込み範囲内か（範囲外は実行時トレースで補う） */
+    bool ContainsLocation(const FVector& Location) const { return Grid.ContainsLocation(Location); }
+
+    /** @brief 縁を取得 */
+    const FParkourLedgeSegment& GetSegment(int32 SegmentIndex) const { return Segments[SegmentIndex]; }
+
+    /** @brief 縁の数 */
+    int32 GetSegmentCount() const { return Segments.Num(); }
+
+#if WITH_EDITOR
+    /**
+     * @brief 焼き込み結果を設定してグリッドを構築（エディタ専用）
+     */
+    void Build(TArray<FParkourLedgeSegment>&& InSegments, TArray<TSoftObjectPtr<AActor>>&& InSourceActors,
+        const FBox& InBounds, float InCellSize);
+#endif
+
+private:
+    /** 焼き込んだ縁 */
+    UPROPERTY(VisibleAnywhere, Category = "Parkour")
+    TArray<FParkourLedgeSegment> Segments;
+
+    /** 縁の元アクター */
+    UPROPERTY(VisibleAnywhere, Category = "Parkour")
+    TArray<TSoftObjectPtr<AActor>> SourceActors;
+
+    /** 縁の空間インデックス */
+    UPROPERTY(VisibleAnywhere, Category = "Parkour")
+    FTraversalCellGrid Grid;
+};
@@ -10,8 +10,14 @@
 #include "GameFramework/CharacterMovementComponent.h"
 
 #include "Engine/World.h"
+#include "Engine/AssetManager.h"
+
+#include "SubSystem/TraceSchedulerSubsystem.h"
+#include "SubSystem/TraversalSurfaceSubsystem.h"
+#include "Object/Parkour/ParkourLedgeIndex.h"
+#include "Object/Parkour/ParkourLedgeBakeVolume.h"
+#include "EngineUtils.h"
 
-#include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/KismetMathLibrary.h"
 
 using namespace UE5Coro;
@@ -33,10 +39,31 @@ UParkourComponent::UParkourComponent()
 // 1. キャラクター参照をキャッシュ
 // 2. 各コンポーネントをキャッシュ
 // 3. ライントレース用の設定を準備
+// 4. モンタージュの非同期読み込みを開始
+// 5. 焼き込み済みの縁があれば先読みを開始
 void UParkourComponent::BeginPlay()
 {
     Super::BeginPlay();
     InitializeComponent();
+    RequestMontagePreload();
+
+    if (LedgeIndices.Num() > 0 && CachedCharacter.IsValid())
+    {
+        bStopPrefetch = false;
+        PrefetchLoop();
+    }
+}
+
+void UParkourComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    bStopPrefetch = true;
+
+    if (MontageLoadHandle.IsValid())
+    {
+        MontageLoadHandle->CancelHandle();
+        MontageLoadHandle.Reset();
+    }
+    Super::EndPlay(EndPlayReason);
 }
 
 // ============================================
@@ -46,7 +73,9 @@ void UParkourComponent::BeginPlay()
 // 処理の流れ:
 // 1. Characterを取得してキャッシュ
 // 2. Capsule、Movement、AnimInstanceをキャッシュ
-// 3. ライントレース用ObjectTypesを準備
+// 3. ライントレース用ObjectTypes・クエリパラメータを準備
+// 4. トレーススケジューラ・面の性質のサブシステムをキャッシュ
+// 5. 焼き込み済みの縁インデックスを収集
 void UParkourComponent::InitializeComponent()
 {
     CachedCharacter = Cast<ACharacter>(GetOwner());
@@ -67,23 +96,83 @@ void UParkourComponent::InitializeComponent()
 
     // ライントレース用ObjectTypesをキャッシュ
     TraceObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_WorldStatic));
+    TraceObjectParams = FCollisionObjectQueryParams(TraceObjectTypes);
+
+    TraceQueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(ParkourTrace), false);
+    TraceQueryParams.AddIgnoredActor(CachedCharacter.Get());
+    // 面の性質をヒット位置の物理マテリアル（ランドスケープのレイヤー等）からも取る
+    TraceQueryParams.bReturnPhysicalMaterial = true;
+    ColumnHits.Reserve(8);
+
+    // 可動物の確認は、可動の WorldStatic に加えて WorldDynamic・PhysicsBody も対象にする
+    DynamicTraceObjectParams = TraceObjectParams;
+    DynamicTraceObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+    DynamicTraceObjectParams.AddObjectTypesToQuery(ECC_PhysicsBody);
+
+    DynamicTraceQueryParams = TraceQueryParams;
+    DynamicTraceQueryParams.MobilityType = EQueryMobilityType::Dynamic;
+
+    TraceScheduler = GetWorld()->GetSubsystem<UTraceSchedulerSubsystem>();
+    TraversalSurfaces = GetWorld()->GetSubsystem<UTraversalSurfaceSubsystem>();
+
+    // 焼き込み済みの縁を一度だけ収集
+    for (TActorIterator<AParkourLedgeBakeVolume> It(GetWorld()); It; ++It)
+    {
+        UParkourLedgeIndex* Index = It->GetLedgeIndex();
+        if (Index && Index->GetSegmentCount() > 0)
+        {
+            LedgeIndices.AddUnique(Index);
+        }
+    }
+}
+
+// 処理の流れ:
+// 1. 未読み込みのモンタージュのパスを集める
+// 2. まとめて非同期読み込みを要求（ハンドルを保持して解放を防ぐ）
+void UParkourComponent::RequestMontagePreload()
+{
+    TArray<FSoftObjectPath> Paths;
+    for (const TPair<EParkourMontageType, TSoftObjectPtr<UAnimMontage>>& Pair : AnimMontageMap)
+    {
+        if (!Pair.Value.IsNull() && !Pair.Value.IsValid())
+        {
+            Paths.Add(Pair.Value.ToSoftObjectPath());
+        }
+    }
+
+    if (Paths.Num() == 0)
+    {
+        return;
+    }
+
+    MontageLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        MoveTemp(Paths), FStreamableDelegate(), MontageLoadPriority);
 }
 
 // ============================================
 // Public API
 // ============================================
 
+bool UParkourComponent::AreMontagesReady() const
+{
+    for (const TPair<EParkourMontageType, TSoftObjectPtr<UAnimMontage>>& Pair : AnimMontageMap)
+    {
+        if (!Pair.Value.IsNull() && !Pair.Value.IsValid())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 // 処理の流れ:
 // 1. すでに実行中なら何もしない
-// 2. パルクールシーケンスを開始
+// 2. 壁を分析（高さ・厚さ・頭上の空きを一度に求める）
+// 3. パルクールシーケンスを開始
 bool UParkourComponent::Parkour()
 {
-
-
     // ===== 壁検出 =====
-    if (bIsPerformingParkour ||
-        !DetectWallImpact(CurrentWallInfo) ||
-        !DetectWallTop(CurrentWallInfo))
+    if (bIsPerformingParkour || !AnalyzeLedge(CurrentWallInfo))
     {
         return false;
     }
@@ -97,9 +186,8 @@ bool UParkourComponent::Parkour()
 
 // 処理の流れ:
 // 1. 初期化と入力無効化
-// 2. 壁を検出
-// 3. 適切なアクション（Climb/Vault）を実行
-// 4. 終了処理
+// 2. 分析済みの壁情報から適切なアクション（Climb/Vault）を実行
+// 3. 終了処理
 TCoroutine<bool> UParkourComponent::ParkourSequence()
 {
     if (!CachedCharacter.IsValid())
@@ -112,9 +200,6 @@ TCoroutine<bool> UParkourComponent::ParkourSequence()
     DisableCharacterInput();
     UE_LOG(LogTemp, Log, TEXT("Parkour: Started"));
 
-    CalculateWallProperties(CurrentWallInfo);
-    CurrentWallInfo.bHasInnerSurface = DetectWallThickness(CurrentWallInfo);
-
     // ===== アクション実行 =====
     if (CurrentWallInfo.bHasInnerSurface)
     {
@@ -201,19 +286,31 @@ TCoroutine<> UParkourComponent::ExecuteVaultSequence()
 
 // 処理の流れ:
 // 1. AnimInstanceとモンタージュの有効性確認
-// 2. モンタージュを再生
-// 3. モンタージュ終了まで待機
+// 2. 読み込み中なら一定時間だけ待ち、間に合わなければ省略
+// 3. モンタージュを再生
+// 4. モンタージュ終了まで待機
 TCoroutine<> UParkourComponent::PlayMontageAsync(EParkourMontageType MontageType)
 {
-    if (!CachedAnimInstance.IsValid() || !AnimMontageMap.Contains(MontageType))
+    const TSoftObjectPtr<UAnimMontage> SoftMontage = AnimMontageMap.FindRef(MontageType);
+    if (!CachedAnimInstance.IsValid() || SoftMontage.IsNull())
     {
         UE_LOG(LogTemp, Warning, TEXT("Parkour: Invalid montage type or AnimInstance"));
         co_return;
     }
 
-    UAnimMontage* Montage = AnimMontageMap[MontageType];
+    // ===== 読み込み待ち =====
+    const double WaitEndTime = GetWorld()->GetTimeSeconds() + MontageLoadWaitTime;
+    while (!SoftMontage.IsValid()
+        && MontageLoadHandle.IsValid() && MontageLoadHandle->IsLoadingInProgress()
+        && GetWorld()->GetTimeSeconds() < WaitEndTime)
+    {
+        co_await NextTick();
+    }
+
+    UAnimMontage* Montage = SoftMontage.Get();
     if (!Montage)
     {
+        UE_LOG(LogTemp, Warning, TEXT("Parkour: Montage not loaded yet, skipped"));
         co_return;
     }
 
@@ -245,10 +342,92 @@ TCoroutine<> UParkourComponent::CleanupParkour()
 // Detection Methods
 // ============================================
 
+// 処理の流れ:
+// 1. 先読みが新しければその縁を使い、古ければ焼き込み済みの縁を探し直す
+// 2. 見つかれば、その手前に可動物が無いかだけトレースで確認して採用
+// 3. 見つからない・可動物に遮られた場合は、静的ジオメトリも含めてトレースで分析
+//    （焼き込みで拾えなかった面も登れるようにする）
+bool UParkourComponent::AnalyzeLedge(FWallDetectionInfo& OutWallInfo)
+{
+    if (LedgeIndices.Num() > 0 && CachedCharacter.IsValid())
+    {
+        bool bFoundBaked = false;
+        if (IsPrefetchFresh() && bHasPrefetchedLedge)
+        {
+            OutWallInfo = PrefetchedLedge;
+            bFoundBaked = true;
+        }
+        else
+        {
+            bFoundBaked = FindBakedLedge(OutWallInfo);
+        }
+
+        if (bFoundBaked)
+        {
+            const FVector TraceStart = CachedCharacter->GetActorLocation() - FVector(0, 0, CharacterCenterOffset);
+
+            FHitResult DynamicHit;
+            if (!PerformLineTrace(TraceStart, OutWallInfo.ImpactLocation, DynamicHit, true))
+            {
+                return true;
+            }
+        }
+    }
+
+    return AnalyzeLedgeWithTraces(OutWallInfo);
+}
+
+// 処理の流れ:
+// 1. 前方トレースで壁の接触位置と法線を得る
+// 2. 壁の内側・手前で下向きマルチトレースし、壁の上端と頭上の空きを得る
+// 3. 内側・奥は手前の上端の高さから下向きの単発トレースで内側の上端を得る（厚さの判定）
+//    （奥では頭上の空きを使わないので、マルチトレースと天井トレースは不要）
+// 4. 高さ・厚さ・登りの要否を計算
+//    トレース予算が取れなければ分析をやめる（次の入力で再試行）
+bool UParkourComponent::AnalyzeLedgeWithTraces(FWallDetectionInfo& OutWallInfo)
+{
+    OutWallInfo = FWallDetectionInfo();
+
+    if (!DetectWallImpact(OutWallInfo))
+    {
+        return false;
+    }
+
+    // 法線の逆方向 = 壁の内側
+    const FVector IntoWall = -OutWallInfo.SurfaceNormal.GetSafeNormal();
+
+    if (!TraceLedgeColumn(OutWallInfo.ImpactLocation + IntoWall * 10.0f, OutWallInfo.TopLocation, OutWallInfo.ClearanceHeight))
+    {
+        return false;
+    }
+
+    const FVector InnerColumn = OutWallInfo.ImpactLocation + IntoWall * 50.0f;
+    const FVector InnerStart(InnerColumn.X, InnerColumn.Y, OutWallInfo.TopLocation.Z + 1.0f);
+
+    FHitResult InnerHit;
+    OutWallInfo.bHasInnerSurface = PerformLineTrace(InnerStart, InnerColumn, InnerHit);
+    if (OutWallInfo.bHasInnerSurface)
+    {
+        // 奥が手前の上端より高い（食い込んで開始した）場合は同じ高さとみなす
+        OutWallInfo.InnerTopLocation = InnerHit.bStartPenetrating
+            ? FVector(InnerColumn.X, InnerColumn.Y, OutWallInfo.TopLocation.Z)
+            : InnerHit.Location;
+    }
+
+    if (OutWallInfo.bHasInnerSurface)
+    {
+        const float Thickness = OutWallInfo.TopLocation.Z - OutWallInfo.InnerTopLocation.Z;
+        OutWallInfo.bIsThickWall = Thickness < ThicknessThreshold;
+    }
+
+    CalculateWallProperties(OutWallInfo);
+    return true;
+}
+
 // 処理の流れ:
 // 1. トレース位置を計算
 // 2. ライントレースを実行
-// 3. ヒットしたアクターが「NoParkour」タグを持つか確認
+// 3. ヒットした面がパルクール禁止か確認
 // 4. 壁の接触位置と法線を記録
 bool UParkourComponent::DetectWallImpact(FWallDetectionInfo& OutWallInfo)
 {
@@ -269,13 +448,14 @@ bool UParkourComponent::DetectWallImpact(FWallDetectionInfo& OutWallInfo)
         return false;
     }
 
-    if (const AActor* HitActor = HitResult.GetActor())
+    const ETraversalFlags SurfaceFlags = TraversalSurfaces.IsValid()
+        ? TraversalSurfaces->GetFlags(HitResult)
+        : UTraversalSurfaceSubsystem::GetFlagsForHit(GetWorld(), HitResult);
+
+    if (EnumHasAnyFlags(SurfaceFlags, ETraversalFlags::NoParkour))
     {
-        if (HitActor->ActorHasTag(FName("NoParkour")))
-        {
-            UE_LOG(LogTemp, Warning, TEXT("Parkour: Hit actor has 'NoParkour' tag"));
-            return false;
-        }
+        UE_LOG(LogTemp, Warning, TEXT("Parkour: Hit surface is marked NoParkour"));
+        return false;
     }
 
     OutWallInfo.ImpactLocation = HitResult.Location;
@@ -285,84 +465,223 @@ bool UParkourComponent::DetectWallImpact(FWallDetectionInfo& OutWallInfo)
 }
 
 // 処理の流れ:
-// 1. 法線から回転を計算
-// 2. トレース位置を計算（上方向に検出）
-// 3. ライントレースを実行
-// 4. 壁の上端位置を記録
-bool UParkourComponent::DetectWallTop(FWallDetectionInfo& InOutWallInfo)
+// 1. 検出範囲の上限から接触位置の高さまで、下向きにマルチトレース（全ての面が返る）
+// 2. 最も低い面を壁の上端とする
+// 3. 上にも面があれば、上端から上向きにトレースして障害物の下面までを頭上の空きとする
+//    （下向きのヒットは障害物の上面なので、そのままでは厚みの分だけ空きを多く見積もる）
+//    障害物の上面までで登りに足りない場合は、結果が変わらないので上向きのトレースを省く
+bool UParkourComponent::TraceLedgeColumn(const FVector& ColumnLocation, FVector& OutTopLocation, float& OutClearance)
 {
-    const FRotator NormalRotation = UKismetMathLibrary::MakeRotFromX(InOutWallInfo.SurfaceNormal);
-    const FVector NormalForward = UKismetMathLibrary::GetForwardVector(NormalRotation);
+    const FVector TraceStart = ColumnLocation + FVector(0, 0, MaxDetectionHeight);
+    const FVector TraceEnd = ColumnLocation;
 
-    const FVector TraceStart = InOutWallInfo.ImpactLocation + (NormalForward * -10.0f);
-    const FVector TraceEnd = TraceStart + FVector(0, 0, MaxDetectionHeight);
+    // ジャンプ入力への即応が必要なのでUrgent（予算にはカウント）
+    // 予算が取れない場合は分析しない
+    if (TraceScheduler.IsValid() && !TraceScheduler->TryConsumeBudget(ETracePriority::Urgent))
+    {
+        return false;
+    }
 
-    FHitResult HitResult;
-    if (!PerformLineTrace(TraceEnd, TraceStart, HitResult))
+    ColumnHits.Reset();
+    GetWorld()->LineTraceMultiByObjectType(ColumnHits, TraceStart, TraceEnd, TraceObjectParams, TraceQueryParams);
+
+    // 結果は開始位置から近い順（上から順）
+    const int32 TopIndex = ColumnHits.Num() - 1;
+    if (TopIndex < 0)
     {
         return false;
     }
 
-    InOutWallInfo.TopLocation = HitResult.Location;
+    const FHitResult& TopHit = ColumnHits[TopIndex];
+    if (TopHit.bStartPenetrating)
+    {
+        return false;
+    }
+
+    OutTopLocation = TopHit.Location;
+
+    OutClearance = TraceStart.Z - OutTopLocation.Z;
+
+    if (TopIndex > 0)
+    {
+        if (ColumnHits[TopIndex - 1].bStartPenetrating)
+        {
+            OutClearance = 0.0f;
+        }
+        else if (ColumnHits[TopIndex - 1].Location.Z - OutTopLocation.Z < ClimbClearanceHeight)
+        {
+            // 障害物の上面でも登りに足りなければ下面はさらに低いので、トレースせず上面までを空きとする
+            OutClearance = ColumnHits[TopIndex - 1].Location.Z - OutTopLocation.Z;
+        }
+        else
+        {
+            // 上端の面自体に当たらないよう少し浮かせる
+            FHitResult CeilingHit;
+            if (PerformLineTrace(OutTopLocation + FVector(0, 0, 1.0f), TraceStart, CeilingHit))
+            {
+                OutClearance = CeilingHit.bStartPenetrating ? 0.0f : CeilingHit.Location.Z - OutTopLocation.Z;
+            }
+        }
+    }
+
     return true;
 }
 
 // 処理の流れ:
-// 1. 法線から回転を計算
-// 2. 内側表面のトレース位置を計算
-// 3. ライントレースを実行
-// 4. 内側の上端位置を記録
-// 5. 壁の厚さを計算
-bool UParkourComponent::DetectWallThickness(FWallDetectionInfo& InOutWallInfo)
+// 1. 足元付近の高さで、前方の検出距離内にある縁を列挙
+// 2. こちらを向いていて、接触位置が線分の範囲・壁の高さの範囲に収まるものを候補にする
+// 3. 最も近い縁から、トレース版と同じ形の壁情報を組み立てる
+bool UParkourComponent::FindBakedLedge(FWallDetectionInfo& OutWallInfo) const
 {
-    const FRotator NormalRotation = UKismetMathLibrary::MakeRotFromX(InOutWallInfo.SurfaceNormal);
-    const FVector NormalForward = UKismetMathLibrary::GetForwardVector(NormalRotation);
+    if (!CachedCharacter.IsValid())
+    {
+        return false;
+    }
 
-    const FVector TraceStart = InOutWallInfo.ImpactLocation + (NormalForward * -50.0f);
-    const FVector TraceEnd = TraceStart + FVector(0, 0, MaxDetectionHeight);
+    const FVector Origin = CachedCharacter->GetActorLocation() - FVector(0, 0, CharacterCenterOffset);
+    const FVector Forward = CachedCharacter->GetActorForwardVector();
 
-    FHitResult HitResult;
-    if (!PerformLineTrace(TraceEnd, TraceStart, HitResult))
+    const FParkourLedgeSegment* BestSegment = nullptr;
+    FVector BestImpact = FVector::ZeroVector;
+    float BestDistance = TNumericLimits<float>::Max();
+
+    for (const UParkourLedgeIndex* Index : LedgeIndices)
+    {
+        if (!Index || !Index->ContainsLocation(Origin))
+        {
+            continue;
+        }
+
+        Index->ForEachSegmentNear(Origin, WallDetectionDistance,
+            [&](int32 SegmentIndex, const FParkourLedgeSegment& Segment)
+            {
+                const FVector Normal(Segment.Normal);
+
+                // 壁に向かっているか
+                const float Facing = -FVector::DotProduct(Forward, Normal);
+                if (Facing <= KINDA_SMALL_NUMBER)
+                {
+                    return;
+                }
+
+                // 前方トレースと同じく、前方向に沿った壁までの距離
+                const float PlaneDistance = FVector::DotProduct(Origin - Segment.Start, Normal);
+                const float Distance = PlaneDistance / Facing;
+                if (PlaneDistance < 0.0f || Distance > WallDetectionDistance || Distance >= BestDistance)
+                {
+                    return;
+                }
+
+                const FVector Impact = Origin + Forward * Distance;
+                if (Impact.Z < Segment.BottomZ || Impact.Z >= Segment.Start.Z)
+                {
+                    return;
+                }
+
+                // 線分の範囲内か
+                const FVector Edge = Segment.End - Segment.Start;
+                const float U = FVector::DotProduct(Impact - Segment.Start, Edge.GetSafeNormal2D());
+                if (U < 0.0f || U > Edge.Size2D())
+                {
+                    return;
+                }
+
+                BestSegment = &Segment;
+                BestImpact = Impact;
+                BestDistance = Distance;
+            });
+    }
+
+    if (!BestSegment)
     {
         return false;
     }
 
-    InOutWallInfo.InnerTopLocation = HitResult.Location;
+    const FVector Normal(BestSegment->Normal);
+    const float TopZ = BestSegment->Start.Z;
+
+    OutWallInfo = FWallDetectionInfo();
+    OutWallInfo.ImpactLocation = BestImpact;
+    OutWallInfo.SurfaceNormal = Normal;
+    OutWallInfo.TopLocation = FVector(BestImpact.X, BestImpact.Y, TopZ) - Normal * 10.0f;
+    OutWallInfo.ClearanceHeight = BestSegment->Clearance;
+    OutWallInfo.bHasInnerSurface = BestSegment->bHasInnerSurface;
 
-    const float Thickness = InOutWallInfo.TopLocation.Z - InOutWallInfo.InnerTopLocation.Z;
-    InOutWallInfo.bIsThickWall = Thickness < ThicknessThreshold;
+    if (BestSegment->bHasInnerSurface)
+    {
+        OutWallInfo.InnerTopLocation = FVector(BestImpact.X, BestImpact.Y, TopZ - BestSegment->InnerDrop) - Normal * 50.0f;
+        OutWallInfo.bIsThickWall = BestSegment->InnerDrop < ThicknessThreshold;
+    }
 
+    CalculateWallProperties(OutWallInfo);
     return true;
 }
 
 // 処理の流れ:
-// 1. 壁の高さを計算
-// 2. 高さが閾値を超える場合、登りが必要と判定
-void UParkourComponent::CalculateWallProperties(FWallDetectionInfo& InOutWallInfo)
+// 1. 実行中でなければ、一定間隔で前方の焼き込み済みの縁を探す
+// 2. 結果と、探した時刻・位置・向きを保持（トレースは行わない）
+TCoroutine<> UParkourComponent::PrefetchLoop()
 {
-    InOutWallInfo.Height = InOutWallInfo.TopLocation.Z - InOutWallInfo.ImpactLocation.Z;
-    InOutWallInfo.bRequiresClimbing = InOutWallInfo.Height > ClimbHeightThreshold;
+    while (!bStopPrefetch && CachedCharacter.IsValid())
+    {
+        co_await Seconds(PrefetchInterval);
+
+        if (bStopPrefetch || !CachedCharacter.IsValid())
+        {
+            co_return;
+        }
+
+        if (bIsPerformingParkour)
+        {
+            bHasPrefetchedLedge = false;
+            bHasPrefetchResult = false;
+            continue;
+        }
+
+        bHasPrefetchedLedge = FindBakedLedge(PrefetchedLedge);
+        bHasPrefetchResult = true;
+        PrefetchTime = GetWorld()->GetTimeSeconds();
+        PrefetchOrigin = CachedCharacter->GetActorLocation();
+        PrefetchForward = CachedCharacter->GetActorForwardVector();
+    }
 }
 
 // 処理の流れ:
-// 1. トレース位置を計算（200cm上方から前方）
-// 2. ライントレースを実行
-// 3. 前方に障害物がない場合のみ登れる
-bool UParkourComponent::CanPerformClimb() const
+// 1. 次の先読みまでの時間内か
+// 2. 先読みした位置からほとんど動いておらず、向きも変わっていないか
+bool UParkourComponent::IsPrefetchFresh() const
 {
-    if (!CachedCharacter.IsValid())
+    if (!bHasPrefetchResult || !CachedCharacter.IsValid())
     {
         return false;
     }
 
-    const FVector OwnerLocation = CachedCharacter->GetActorLocation();
-    const FVector OwnerForward = CachedCharacter->GetActorForwardVector();
+    if (GetWorld()->GetTimeSeconds() - PrefetchTime > PrefetchInterval)
+    {
+        return false;
+    }
 
-    const FVector TraceStart = OwnerLocation + FVector(0, 0, 200.0f);
-    const FVector TraceEnd = TraceStart + (OwnerForward * WallDetectionDistance);
+    // 約5度以内の向きの変化まで許容
+    static constexpr float MinForwardDot = 0.996f;
 
-    FHitResult HitResult;
-    return !PerformLineTrace(TraceStart, TraceEnd, HitResult);
+    return FVector::DistSquared(CachedCharacter->GetActorLocation(), PrefetchOrigin) <= FMath::Square(PrefetchReuseDistance)
+        && FVector::DotProduct(CachedCharacter->GetActorForwardVector(), PrefetchForward) >= MinForwardDot;
+}
+
+// 処理の流れ:
+// 1. 壁の高さを計算
+// 2. 高さが閾値を超える場合、登りが必要と判定
+void UParkourComponent::CalculateWallProperties(FWallDetectionInfo& InOutWallInfo) const
+{
+    InOutWallInfo.Height = InOutWallInfo.TopLocation.Z - InOutWallInfo.ImpactLocation.Z;
+    InOutWallInfo.bRequiresClimbing = InOutWallInfo.Height > ClimbHeightThreshold;
+}
+
+// 処理の流れ:
+// 1. 分析済みの頭上の空きが足りる場合のみ登れる（追加のトレースなし）
+bool UParkourComponent::CanPerformClimb() const
+{
+    return CurrentWallInfo.ClearanceHeight >= ClimbClearanceHeight;
 }
 
 // ============================================
@@ -449,26 +768,24 @@ void UParkourComponent::EnableCharacterInput()
 // ============================================
 
 // 処理の流れ:
-// 1. キャッシュされたObjectTypesを使用
-// 2. ライントレースを実行
+// 1. キャッシュされたクエリパラメータで要求を作成
+// 2. ジャンプ入力への即応が必要なのでUrgentとして即時実行（予算にはカウント）
 // 3. ヒット結果を返す
-bool UParkourComponent::PerformLineTrace(const FVector& Start, const FVector& End, FHitResult& OutHitResult) const
+bool UParkourComponent::PerformLineTrace(const FVector& Start, const FVector& End, FHitResult& OutHitResult, bool bDynamicOnly) const
 {
-    constexpr bool bTraceComplex = false;
-    constexpr bool bIgnoreSelf = true;
-    constexpr EDrawDebugTrace::Type DrawDebugType = EDrawDebugTrace::None;
-
-    TArray<AActor*> ActorsToIgnore;
-
-    return UKismetSystemLibrary::LineTraceSingleForObjects(
-        GetWorld(),
-        Start,
-        End,
-        TraceObjectTypes,
-        bTraceComplex,
-        ActorsToIgnore,
-        DrawDebugType,
-        OutHitResult,
-        bIgnoreSelf
-    );
-}
\ No newline at end of file
+    FTraceRequest Request;
+    Request.Start = Start;
+    Request.End = End;
+    Request.bByObjectType = true;
+    Request.ObjectQueryParams = bDynamicOnly ? DynamicTraceObjectParams : TraceObjectParams;
+    Request.Params = bDynamicOnly ? DynamicTraceQueryParams : TraceQueryParams;
+    Request.Priority = ETracePriority::Urgent;
+    Request.Requester = this;
+
+    if (TraceScheduler.IsValid())
+    {
+        return TraceScheduler->ExecuteImmediate(Request, OutHitResult);
+    }
+
+    return GetWorld()->LineTraceSingleByObjectType(OutHitResult, Start, End, Request.ObjectQueryParams, Request.Params);
+}
@@ -4,11 +4,15 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Engine/StreamableManager.h"
 #include "UE5Coro.h"
 #include "ParkourComponent.generated.h"
 
 class UCharacterMovementComponent;
 class UCapsuleComponent;
+class UTraceSchedulerSubsystem;
+class UTraversalSurfaceSubsystem;
+class UParkourLedgeIndex;
 
 using namespace UE5Coro;
 
@@ -36,6 +40,10 @@ struct FWallDetectionInfo
     FVector TopLocation = FVector::ZeroVector;
     FVector InnerTopLocation = FVector::ZeroVector;
     float Height = 0.0f;
+
+    /** 上端から、その上にある次の面までの高さ（上に何もなければ検出範囲の上限まで） */
+    float ClearanceHeight = 0.0f;
+
     bool bIsThickWall = true;
     bool bRequiresClimbing = true;
     bool bHasInnerSurface = false;
@@ -67,6 +75,7 @@ protected:
     // ============================================
 
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     // ============================================
@@ -87,6 +96,23 @@ public:
     UFUNCTION(BlueprintPure, Category = "Parkour")
     bool IsPerformingParkour() const { return bIsPerformingParkour; }
 
+    /**
+     * @brief 移動中に先読みした、前方のパルクール対象があるか
+     * @details 焼き込み済みの縁のみ対象。先読みが新しければパルクール開始時にもそのまま使う
+     */
+    UFUNCTION(BlueprintPure, Category = "Parkour")
+    bool HasPrefetchedLedge() const { return bHasPrefetchedLedge; }
+
+    /** @brief 先読みした縁の情報 */
+    const FWallDetectionInfo& GetPrefetchedLedge() const { return PrefetchedLedge; }
+
+    /**
+     * @brief 全モンタージュの読み込みが終わっているか
+     * @details 未完了でもパルクールは実行でき、読み込み前のモンタージュは短く待ってから省略する
+     */
+    UFUNCTION(BlueprintPure, Category = "Parkour")
+    bool AreMontagesReady() const;
+
     // ============================================
     // Delegates
     // ============================================
@@ -105,6 +131,9 @@ private:
     /** @brief コンポーネントとキャッシュを初期化 */
     void InitializeComponent();
 
+    /** @brief モンタージュの非同期読み込みを開始 */
+    void RequestMontagePreload();
+
     /** @brief パルクールメインシーケンス（コルーチン） */
     TCoroutine<bool> ParkourSequence();
 
@@ -124,17 +153,50 @@ private:
     // Detection Methods
     // ============================================
 
+    /**
+     * @brief 壁の高さ・厚さ・頭上の空きを求める
+     * @details 焼き込み済みの縁を優先し、焼き込み範囲内では可動物だけをトレースする
+     * @return パルクール可能な壁が見つかった場合 true
+     */
+    bool AnalyzeLedge(FWallDetectionInfo& OutWallInfo);
+
+    /**
+     * @brief 前方1本 + 下向きマルチトレース1組で、壁の高さ・厚さ・頭上の空きをまとめて求める
+     * @return パルクール可能な壁が見つかった場合 true
+     */
+    bool AnalyzeLedgeWithTraces(FWallDetectionInfo& OutWallInfo);
+
+    /**
+     * @brief 焼き込み済みインデックスから前方の縁を探す（トレースなし）
+     * @param OutWallInfo 見つかった縁から組み立てた壁情報
+     * @return 縁が見つかった場合 true
+     */
+    bool FindBakedLedge(FWallDetectionInfo& OutWallInfo) const;
+
+    /** @brief 移動中に前方の縁を先読みする（コルーチン） */
+    TCoroutine<> PrefetchLoop();
+
+    /**
+     * @brief 先読みの結果をそのまま使えるか
+     * @details 先読みからの経過時間・移動距離・向きの変化が小さい場合のみ
+     */
+    bool IsPrefetchFresh() const;
+
     /** @brief 壁の初期接触を検出 */
     bool DetectWallImpact(FWallDetectionInfo& OutWallInfo);
 
-    /** @brief 壁の上端を検出 */
-    bool DetectWallTop(FWallDetectionInfo& InOutWallInfo);
-
-    /** @brief 壁の厚さを検出 */
-    bool DetectWallThickness(FWallDetectionInfo& InOutWallInfo);
+    /**
+     * @brief 上から下へのマルチトレースで、指定位置の最も低い面（壁の上端）と頭上の空きを求める
+     * @details 壁の手前側の列にだけ使う（奥の列は上端の高さだけを単発トレースで求める）
+     * @param ColumnLocation 壁の内側の位置（Zは接触位置）
+     * @param OutTopLocation 壁の上端
+     * @param OutClearance 上端から頭上の障害物の下面までの高さ
+     * @return 上端が見つかった場合 true
+     */
+    bool TraceLedgeColumn(const FVector& ColumnLocation, FVector& OutTopLocation, float& OutClearance);
 
     /** @brief 壁の高さと厚さを計算 */
-    void CalculateWallProperties(FWallDetectionInfo& InOutWallInfo);
+    void CalculateWallProperties(FWallDetectionInfo& InOutWallInfo) const;
 
     /** @brief 登ることが可能かチェック */
     bool CanPerformClimb() const;
@@ -159,16 +221,28 @@ private:
     // Helper Methods
     // ============================================
 
-    /** @brief ライントレースを実行 */
-    bool PerformLineTrace(const FVector& Start, const FVector& End, FHitResult& OutHitResult) const;
+    /**
+     * @brief ライントレースを実行
+     * @param bDynamicOnly 可動物のみを対象にするか（焼き込み済みの縁の手前の確認用）
+     */
+    bool PerformLineTrace(const FVector& Start, const FVector& End, FHitResult& OutHitResult, bool bDynamicOnly = false) const;
 
 private:
     // ============================================
     // Settings
     // ============================================
 
+    /** 種類ごとのモンタージュ（BeginPlay後に非同期で読み込む） */
+    UPROPERTY(EditAnywhere, Category = "Parkour|Animation")
+    TMap<EParkourMontageType, TSoftObjectPtr<UAnimMontage>> AnimMontageMap;
+
+    /** モンタージュ読み込みの優先度 */
     UPROPERTY(EditAnywhere, Category = "Parkour|Animation")
-    TMap<EParkourMontageType, UAnimMontage*> AnimMontageMap;
+    int32 MontageLoadPriority = FStreamableManager::AsyncLoadHighPriority;
+
+    /** 再生時に読み込みが終わっていない場合に待つ最大時間（秒）。超えたらモンタージュを省略 */
+    UPROPERTY(EditAnywhere, Category = "Parkour|Animation", meta = (ClampMin = "0.0"))
+    float MontageLoadWaitTime = 0.2f;
 
     UPROPERTY(EditAnywhere, Category = "Parkour|Detection")
     float WallDetectionDistance = 70.0f;
@@ -179,12 +253,25 @@ private:
     UPROPERTY(EditAnywhere, Category = "Parkour|Detection")
     float ClimbHeightThreshold = 80.0f;
 
+    /** 上端と奥の上端の差がこれ未満なら厚い壁（焼き込み済みの縁にも同じ値を使う） */
     UPROPERTY(EditAnywhere, Category = "Parkour|Detection")
     float ThicknessThreshold = 30.0f;
 
     UPROPERTY(EditAnywhere, Category = "Parkour|Detection")
     float CharacterCenterOffset = 55.0f;
 
+    /** 前方の縁を先読みする間隔（秒） */
+    UPROPERTY(EditAnywhere, Category = "Parkour|Detection", meta = (ClampMin = "0.01"))
+    float PrefetchInterval = 0.1f;
+
+    /** 先読みした位置からこの距離以内なら、パルクール開始時に先読みの結果をそのまま使う */
+    UPROPERTY(EditAnywhere, Category = "Parkour|Detection", meta = (ClampMin = "0.0"))
+    float PrefetchReuseDistance = 20.0f;
+
+    /** 登るのに必要な、壁の上端から上の空き */
+    UPROPERTY(EditAnywhere, Category = "Parkour|Detection")
+    float ClimbClearanceHeight = 200.0f;
+
     UPROPERTY(EditAnywhere, Category = "Parkour|Movement")
     float NormalGravityScale = 5.0f;
 
@@ -208,6 +295,32 @@ private:
     /** @brief ライントレース用のObjectTypes（キャッシュ） */
     TArray<TEnumAsByte<EObjectTypeQuery>> TraceObjectTypes;
 
+    /** @brief ライントレース用のクエリパラメータ（キャッシュ） */
+    FCollisionObjectQueryParams TraceObjectParams;
+    FCollisionQueryParams TraceQueryParams;
+
+    /** @brief 焼き込み範囲内で使う、可動物のみのクエリパラメータ（キャッシュ） */
+    FCollisionObjectQueryParams DynamicTraceObjectParams;
+    FCollisionQueryParams DynamicTraceQueryParams;
+
+    /** @brief 下向きマルチトレースの結果バッファ（容量を使い回す） */
+    TArray<FHitResult> ColumnHits;
+
+    /** @brief レベル内の焼き込み済み縁インデックス（BeginPlayで収集） */
+    UPROPERTY(Transient)
+    TArray<UParkourLedgeIndex*> LedgeIndices;
+
+    /** @brief トレーススケジューラ（予算のカウント用） */
+    UPROPERTY()
+    TWeakObjectPtr<UTraceSchedulerSubsystem> TraceScheduler;
+
+    /** @brief 面の性質（パルクール禁止など）のキャッシュ */
+    UPROPERTY()
+    TWeakObjectPtr<UTraversalSurfaceSubsystem> TraversalSurfaces;
+
+    /** @brief モンタージュの読み込みハンドル（保持している間は解放されない） */
+    TSharedPtr<FStreamableHandle> MontageLoadHandle;
+
 private:
     // ============================================
     // Runtime State
@@ -218,4 +331,19 @@ private:
 
     /** @brief 現在検出している壁の情報 */
     FWallDetectionInfo CurrentWallInfo;
+
+    /** @brief 先読みした縁 */
+    FWallDetectionInfo PrefetchedLedge;
+    bool bHasPrefetchedLedge = false;
+
+    /** @brief 先読みの結果があるか（縁が無かった場合も含む） */
+    bool bHasPrefetchResult = false;
+
+    /** @brief 先読みした時刻・位置・向き（鮮度の判定用） */
+    double PrefetchTime = 0.0;
+    FVector PrefetchOrigin = FVector::ZeroVector;
+    FVector PrefetchForward = FVector::ZeroVector;
+
+    /** @brief 先読みループの停止フラグ */
+    bool bStopPrefetch = false;
 };
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include "Component/TimeManipulatorComponent.h"
 #include "Component/PlayerInputBinder.h"
 #include "Component/WallRun/WallRunComponent.h"
+#include "Component/WallRun/WallRunMovementComponent.h"
 #include "Component/PlayerCameraControlComponent.h"
 #include "Component/ParkourComponent.h"
 
@@ -24,8 +25,9 @@
 // ============================================
 // Constructor
 // ============================================
-APlayerCharacter::APlayerCharacter()
-    : bPlayReplayWorld(false)
+APlayerCharacter::APlayerCharacter(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer.SetDefaultSubobjectClass<UWallRunMovementComponent>(ACharacter::CharacterMovementComponentName))
+    , bPlayReplayWorld(false)
     ,bPlaySlowMotion(false)
     , SlowMotionTimer(0.0f)
     , SlowMotionDuration(0.0f)
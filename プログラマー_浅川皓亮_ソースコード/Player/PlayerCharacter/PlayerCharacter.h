@@ -43,7 +43,7 @@ public:
     // ============================================
     // Lifecycle
     // ============================================
-    APlayerCharacter();
+    APlayerCharacter(const FObjectInitializer& ObjectInitializer);
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaTime) override;
     virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
@@ -96,8 +96,8 @@ bool USoundHandle::PlaySound(
     UObject* WorldContext,
     ESoundKinds DataID,
     FName SoundID,
-    bool SetVolume,
     bool isLoop,
+    bool SetVolume,
     float Volume,
     bool IsSpecifyLocation,
     FVector Location)
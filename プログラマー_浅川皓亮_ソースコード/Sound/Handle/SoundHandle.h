@@ -89,6 +89,7 @@ public:
      * @param WorldContext ワールドコンテキスト
      * @param DataID サウンドデータID（"BGM", "SE"など）
      * @param SoundID 再生するサウンドのID
+     * @param isLoop 繰り返し再生するか
      * @param SetVolume カスタム音量を使用するか
      * @param Volume カスタム音量（0-1）
      * @param IsSpecifyLocation 位置指定再生するか
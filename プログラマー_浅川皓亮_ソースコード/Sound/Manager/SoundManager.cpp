@@ -1,7 +1,12 @@
 #include "Sound/SoundManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Components/AudioComponent.h"
+#include "Engine/AssetManager.h"
+#include "GameFramework/PlayerController.h"
 #include "SaveManager.h"
+#include "SubSystem/TimeManagerSubsystem.h"
+#include "FMODStudioModule.h"
+#include "UE5Coro.h"
 
 
 // FMODの低レベルAPIのヘッダーをインクルードします。
@@ -20,6 +25,21 @@
 // FMODAudioComponentの定義が必要なため、インクルードします。
 // UFMODAudioComponent::EventInstance メンバーにアクセスするために必要です。
 #include "FMODAudioComponent.h"
+
+using namespace UE5Coro;
+using namespace UE5Coro::Latent;
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("SE Active Voices"), STAT_SEActiveVoices, STATGROUP_Audio);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("SE Stolen Voices"), STAT_SEStolenVoices, STATGROUP_Audio);
+DECLARE_MEMORY_STAT(TEXT("SE Resident Memory"), STAT_SEResidentMemory, STATGROUP_Audio);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("SE Virtual Sounds"), STAT_SEVirtualSounds, STATGROUP_Audio);
+
+namespace
+{
+    // 読み込み待ちに積める再生リクエストの数
+    constexpr int32 MaxPendingPlays = 4;
+}
+
 // =======================
 // コンストラクタ
 // =======================
@@ -27,10 +47,14 @@
 USoundManager::USoundManager()
     : BGMVolume(1)
     , SEVolume(1)
+    , DefaultAttenuation(nullptr)
     , mCurrentBGM(nullptr)
+    , EventInstance(nullptr)
     , StartTime(0.f)
 
 {
+    DefaultAttenuationSettings.bAttenuate = true;
+    DefaultAttenuationSettings.FalloffDistance = 2000.0f;
 }
 // =======================
 // 初期化処理
@@ -38,37 +62,85 @@ USoundManager::USoundManager()
 
 void USoundManager::Init()
 {
-    // 登録されているサウンドデータを AudioComponent に初期化
+    // 距離減衰は再生のたびに生成せず、ここで一度だけ生成する
+    DefaultAttenuation = NewObject<USoundAttenuation>(this);
+    DefaultAttenuation->Attenuation = DefaultAttenuationSettings;
+
+    // このレベルで使うサウンドだけを事前に読み込む
+    const FName LevelName(*UGameplayStatics::GetCurrentLevelName(this));
+    const FSoundPreloadList* PreloadList = LevelPreloadMap.Find(LevelName);
+
     for (auto& soundMap : SoundDataMap)
     {
-        const ESoundKinds dataTag = soundMap.Key;
         FSoundData& soundData = soundMap.Value;
-        soundData.AudioComponentMap.Reset();
 
-        for (const auto& soundAssetPair : soundData.SoundAssetMap)
-        {
-            const FName waveTag = soundAssetPair.Key;
-            USoundBase* sound = soundAssetPair.Value;
-            if (waveTag.IsNone() || !sound)
-                continue;
+        // BGM は FMOD で再生するのでボイスもアセットの読み込みも不要
+        if (soundMap.Key == ESoundKinds::BGM)
+            continue;
 
-            // 既に登録済みならスキップ
-            if (soundData.AudioComponentMap.Contains(waveTag))
-                continue;
+        CreateVoices(soundData);
+        CreateAttenuationPresets(soundData);
 
-            // 2D サウンドコンポーネントを生成
-            UAudioComponent* AudioComponent = UGameplayStatics::CreateSound2D(this, sound);
-            if (AudioComponent == nullptr)
+        for (const auto& soundAssetPair : soundData.SoundAssetMap)
+        {
+            if (PreloadList && !PreloadList->SoundNames.Contains(soundAssetPair.Key))
                 continue;
 
-            AudioComponent->bAutoDestroy = false;
-
-            soundData.AudioComponentMap.Add(waveTag, AudioComponent);
+            RequestSoundLoad(soundMap.Key, soundAssetPair.Key);
         }
     }
 
     SEVolume = USaveManager::GetSEVolume();
     BGMVolume = USaveManager::GetBGMVolume();
+
+    // 巻き戻し用の記録を確保
+    SoundEventLog.SetNum(SoundEventLogCapacity);
+    SoundEventLogWriteIndex = 0;
+    SoundEventLogCount = 0;
+    RewindSoundTriggers.Reset(SoundEventLogCapacity);
+
+    // 時間倍率・巻き戻しの変更を購読
+    UWorld* World = GetWorld();
+    if (UTimeManagerSubsystem* TimeManager = World ? World->GetSubsystem<UTimeManagerSubsystem>() : nullptr)
+    {
+        TimeManager->OnTimeDilationChanged.RemoveAll(this);
+        TimeManager->OnTimeDilationChanged.AddUObject(this, &USoundManager::OnTimeDilationChanged);
+        OnTimeDilationChanged(TimeManager->GetTimeDilation());
+
+        TimeManager->OnRewindPlaybackChanged.RemoveAll(this);
+        TimeManager->OnRewindPlaybackChanged.AddUObject(this, &USoundManager::OnRewindPlaybackChanged);
+    }
+}
+
+bool USoundManager::IsSoundReady(ESoundKinds SoundType, FName SoundName) const
+{
+    const FSoundData* SoundData = SoundDataMap.Find(SoundType);
+    if (!SoundData)
+    {
+        return false;
+    }
+
+    const TSoftObjectPtr<USoundBase>* SoundAsset = SoundData->SoundAssetMap.Find(SoundName);
+    return SoundAsset && SoundAsset->IsValid();
+}
+
+int32 USoundManager::GetActiveVoiceCount(ESoundKinds SoundType) const
+{
+    const FSoundData* SoundData = SoundDataMap.Find(SoundType);
+    if (!SoundData)
+    {
+        return 0;
+    }
+
+    int32 ActiveCount = 0;
+    for (const FSoundVoice& Voice : SoundData->Voices)
+    {
+        if (IsVoiceActive(Voice))
+        {
+            ++ActiveCount;
+        }
+    }
+    return ActiveCount;
 }
 
 // 音量を保存
@@ -100,7 +172,7 @@ void USoundManager::SetBGMVolume(float NewVolume)
     // 音量が0から0以上になった場合は再生
     if (PreviousBGMVolume == 0.0f && BGMVolume > 0.0f && !BGM->IsPlaying())
     {
-        BGM->Play();
+        PlayBGMInstance();
     }
     // 音量が0になった場合は停止
     else if (BGMVolume == 0.0f && BGM->IsPlaying())
@@ -122,8 +194,8 @@ void USoundManager::SetSEVolume(float vol)
 bool USoundManager::PlaySound(
     ESoundKinds SoundType,
     FName SoundName,
-    const bool SetVolume,
     const bool isLoop,
+    const bool SetVolume,
     float Volume,
     bool IsSpecifyLocation,
     FVector place)
@@ -135,59 +207,954 @@ bool USoundManager::PlaySound(
         return PlayBGM();
     }
 
+    return PlayVoice(SoundType, SoundName, isLoop, SetVolume, Volume, IsSpecifyLocation, place, nullptr) != ESoundPlayResult::Failed;
+}
+
+bool USoundManager::PlaySoundWithAttenuation(
+    ESoundKinds SoundType,
+    FName SoundName,
+    FVector Location,
+    const FSoundAttenuationSettings& Attenuation,
+    bool isLoop)
+{
+    if (SoundType == ESoundKinds::BGM)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SoundManager: BGM does not support attenuation"));
+        return false;
+    }
+
+    return PlayVoice(SoundType, SoundName, isLoop, false, 1.0f, true, Location, &Attenuation) != ESoundPlayResult::Failed;
+}
+
+ESoundPlayResult USoundManager::PlayVoice(
+    ESoundKinds SoundType,
+    FName SoundName,
+    bool isLoop,
+    bool SetVolume,
+    float Volume,
+    bool IsSpecifyLocation,
+    const FVector& place,
+    const FSoundAttenuationSettings* AttenuationOverride,
+    float PitchOverride,
+    float StartOffset)
+{
     // サウンドデータの存在チェック
     if (!SoundDataMap.Contains(SoundType))
     {
-        return false;
+        return ESoundPlayResult::Failed;
     }
 
     FSoundData& SoundData = SoundDataMap[SoundType];
-    if (!SoundData.AudioComponentMap.Contains(SoundName))
+    const TSoftObjectPtr<USoundBase>* SoundAsset = SoundData.SoundAssetMap.Find(SoundName);
+    if (!SoundAsset)
     {
-        return false;
+        return ESoundPlayResult::Failed;
     }
 
-    UAudioComponent* AudioComponent = Cast<UAudioComponent>(SoundData.AudioComponentMap[SoundName]);
-    if (!AudioComponent)
+    FSoundPlayRequest Request;
+    Request.SoundType = SoundType;
+    Request.SoundName = SoundName;
+    Request.bLoop = isLoop;
+    Request.bSetVolume = SetVolume;
+    Request.Volume = Volume;
+    Request.bSpecifyLocation = IsSpecifyLocation;
+    Request.Location = place;
+    Request.bOverrideAttenuation = AttenuationOverride != nullptr;
+    if (AttenuationOverride)
     {
-        return false;
+        Request.Attenuation = *AttenuationOverride;
+    }
+
+    USoundBase* Sound = SoundAsset->Get();
+    if (!Sound)
+    {
+        // 読み込みを始め、終わったら再生する
+        const bool bQueued = QueuePendingPlay(Request);
+
+        RequestSoundLoad(SoundType, SoundName);
+        return bQueued ? ESoundPlayResult::Pending : ESoundPlayResult::Failed;
+    }
+
+    // LRU用に最後に使った順番を更新
+    if (FSoundResidency* Residency = SoundData.ResidencyMap.Find(SoundName))
+    {
+        Residency->LastUsedOrder = NextSoundUseOrder++;
     }
 
+    const FSoundVoiceSettings* FoundSettings = SoundData.VoiceSettingsMap.Find(SoundName);
+    const FSoundVoiceSettings& VoiceSettings = FoundSettings ? *FoundSettings : SoundData.DefaultVoiceSettings;
+
     // 音量設定：カスタム音量 or デフォルト音量
     float FinalVolume = SetVolume ? Volume : SEVolume;
     FinalVolume = FMath::Clamp(FinalVolume, 0.0f, 1.0f);
+
+    // 巻き戻しで逆再生できるように記録するか（ループ・巻き戻し中の再生・仮想化からの復帰は除く）
+    // 最初から仮想化した音も、聞こえる範囲で鳴っていたはずの音として記録する
+    const bool bRecordEvent = !isLoop && !bRewindPlaybackActive && StartOffset <= 0.0f;
+
+    // 聞こえない距離の音はボイスを使わずに仮想化
+    const float AudibleRadius = IsSpecifyLocation ? GetAudibleRadius(SoundData, VoiceSettings, AttenuationOverride) : 0.0f;
+    if (IsSpecifyLocation && !IsWithinAudibleRange(place, AudibleRadius))
+    {
+        if (!VirtualizeSound(Request, Sound, AudibleRadius, VoiceSettings.Priority, StartOffset))
+        {
+            return ESoundPlayResult::Failed;
+        }
+
+        if (bRecordEvent)
+        {
+            RecordSoundEvent(SoundType, SoundName, FinalVolume, IsSpecifyLocation, place);
+        }
+        return ESoundPlayResult::Played;
+    }
+
+    // ボイスを割り当て（同時発音数・優先度で足りなければ仮想化）
+    FSoundVoice* Voice = AcquireVoice(SoundData, SoundName, VoiceSettings);
+    if (!Voice)
+    {
+        if (VirtualizeSound(Request, Sound, AudibleRadius, VoiceSettings.Priority, StartOffset))
+        {
+            if (bRecordEvent)
+            {
+                RecordSoundEvent(SoundType, SoundName, FinalVolume, IsSpecifyLocation, place);
+            }
+            return ESoundPlayResult::Played;
+        }
+
+        UE_LOG(LogTemp, Verbose, TEXT("SoundManager: No voice available for %s, skipped"), *SoundName.ToString());
+        return ESoundPlayResult::Failed;
+    }
+
+    UAudioComponent* AudioComponent = Voice->AudioComponent;
+    AudioComponent->SetSound(Sound);
     AudioComponent->SetVolumeMultiplier(FinalVolume);
 
+    // 時間倍率に合わせたピッチ（指定があればそちらを優先）
+    const bool bFollowTimeDilation = PitchOverride <= 0.0f && VoiceSettings.TimeDomain == ESoundTimeDomain::World;
+    if (PitchOverride > 0.0f)
+    {
+        AudioComponent->SetPitchMultiplier(PitchOverride);
+    }
+    else
+    {
+        AudioComponent->SetPitchMultiplier(bFollowTimeDilation ? GetTimeDilationPitch() : 1.0f);
+    }
+
     // 位置指定がある場合は3Dサウンドとして再生
+    AudioComponent->bAllowSpatialization = IsSpecifyLocation;
+    AudioComponent->bOverrideAttenuation = false;
+    AudioComponent->AttenuationSettings = nullptr;
     if (IsSpecifyLocation)
     {
         AudioComponent->SetWorldLocation(place);
 
-        // 距離減衰を適用
-        USoundAttenuation* AttenuationSettings = NewObject<USoundAttenuation>();
-        if (AttenuationSettings)
+        // 距離減衰を適用（個別指定はボイスに直接書き込み、それ以外は生成済みのプリセットを共有）
+        if (AttenuationOverride)
+        {
+            AudioComponent->bOverrideAttenuation = true;
+            AudioComponent->AttenuationOverrides = *AttenuationOverride;
+        }
+        else
         {
-            AttenuationSettings->Attenuation.bAttenuate = true;
-            AttenuationSettings->Attenuation.FalloffDistance = 2000.0f;
-            AudioComponent->AttenuationSettings = AttenuationSettings;
+            AudioComponent->AttenuationSettings = FindAttenuation(SoundData, VoiceSettings.AttenuationPreset);
         }
     }
 
-    if (isLoop)
+    Voice->SoundName = SoundName;
+    Voice->Priority = VoiceSettings.Priority;
+    Voice->Volume = FinalVolume;
+    Voice->PlayOrder = NextVoicePlayOrder++;
+    Voice->bLooping = isLoop;
+    Voice->bFollowTimeDilation = bFollowTimeDilation;
+    Voice->AudibleRadius = AudibleRadius;
+    Voice->StartTime = GetWorld() ? GetWorld()->GetAudioTimeSeconds() - StartOffset : 0.0;
+    Voice->Request = Request;
+
+    // サウンド再生（仮想化から復帰した場合は続きから）
+    AudioComponent->Play(StartOffset);
+
+    // 位置指定のループ音は離れたら仮想化するので監視を始める
+    if (isLoop && IsSpecifyLocation && !bVirtualLoopRunning)
+    {
+        UpdateVirtualSounds();
+    }
+
+    // 巻き戻しで逆再生できるように記録
+    if (bRecordEvent)
+    {
+        RecordSoundEvent(SoundType, SoundName, FinalVolume, IsSpecifyLocation, place);
+    }
+
+    UpdateVoiceStats();
+    return ESoundPlayResult::Played;
+}
+
+// =======================
+// ボイスプール
+// =======================
+
+void USoundManager::CreateVoices(FSoundData& SoundData)
+{
+    // 再初期化時は前のボイスを破棄
+    for (FSoundVoice& Voice : SoundData.Voices)
     {
-        if (USoundWave* SoundWave = Cast<USoundWave>(AudioComponent->Sound))
+        if (Voice.AudioComponent)
         {
-            SoundWave->bLooping = true;
+            Voice.bLooping = false;
+            Voice.AudioComponent->Stop();
+            Voice.AudioComponent->DestroyComponent();
+        }
+    }
+    SoundData.Voices.Reset(SoundData.VoiceCount);
 
-            LoopSEMap.Add(SoundName, AudioComponent);
+    for (int32 Index = 0; Index < SoundData.VoiceCount; ++Index)
+    {
+        UAudioComponent* AudioComponent = NewObject<UAudioComponent>(this);
+        if (!AudioComponent)
+        {
+            UE_LOG(LogTemp, Error, TEXT("SoundManager: Failed to create voice"));
+            continue;
         }
+
+        AudioComponent->bAutoActivate = false;
+        AudioComponent->bAutoDestroy = false;
+        AudioComponent->RegisterComponentWithWorld(GetWorld());
+        AudioComponent->OnAudioFinishedNative.AddUObject(this, &USoundManager::OnVoiceFinished);
+
+        FSoundVoice& Voice = SoundData.Voices.AddDefaulted_GetRef();
+        Voice.AudioComponent = AudioComponent;
     }
+}
 
-    // サウンド再生
-    AudioComponent->Play();
+FSoundVoice* USoundManager::AcquireVoice(FSoundData& SoundData, FName SoundName, const FSoundVoiceSettings& Settings)
+{
+    // 同時発音数を超えていれば同じサウンドの一番古いボイスを使い回す
+    int32 SameSoundCount = 0;
+    FSoundVoice* FreeVoice = nullptr;
+    for (FSoundVoice& Voice : SoundData.Voices)
+    {
+        if (!Voice.AudioComponent)
+        {
+            continue;
+        }
+
+        if (!IsVoiceActive(Voice))
+        {
+            if (!FreeVoice)
+            {
+                FreeVoice = &Voice;
+            }
+            continue;
+        }
+
+        if (Voice.SoundName == SoundName)
+        {
+            ++SameSoundCount;
+        }
+    }
+
+    FSoundVoice* Target = nullptr;
+    if (SameSoundCount >= Settings.MaxPolyphony)
+    {
+        Target = SelectVoiceToSteal(SoundData.Voices, ESoundVoiceStealMode::Oldest, SoundName, TNumericLimits<int32>::Max());
+    }
+    else if (FreeVoice)
+    {
+        return FreeVoice;
+    }
+    else
+    {
+        // 空きがなければ優先度が同じか低いボイスを奪う
+        Target = SelectVoiceToSteal(SoundData.Voices, SoundData.StealMode, NAME_None, Settings.Priority);
+    }
+
+    if (!Target)
+    {
+        return nullptr;
+    }
+
+    Target->bLooping = false;
+    Target->AudioComponent->Stop();
+    ++StolenVoiceCount;
+    INC_DWORD_STAT(STAT_SEStolenVoices);
+    return Target;
+}
+
+FSoundVoice* USoundManager::SelectVoiceToSteal(TArray<FSoundVoice>& Voices, ESoundVoiceStealMode StealMode, FName SoundName, int32 MaxPriority)
+{
+    FSoundVoice* Best = nullptr;
+    for (FSoundVoice& Voice : Voices)
+    {
+        if (!IsVoiceActive(Voice) || Voice.Priority > MaxPriority)
+        {
+            continue;
+        }
+        if (!SoundName.IsNone() && Voice.SoundName != SoundName)
+        {
+            continue;
+        }
+
+        if (!Best)
+        {
+            Best = &Voice;
+            continue;
+        }
+
+        // 優先度が低いものを優先し、同じ優先度なら古いもの/小さいものを選ぶ
+        if (Voice.Priority != Best->Priority)
+        {
+            if (Voice.Priority < Best->Priority)
+            {
+                Best = &Voice;
+            }
+            continue;
+        }
+
+        const bool bBetter = StealMode == ESoundVoiceStealMode::Quietest
+            ? (Voice.Volume < Best->Volume || (Voice.Volume == Best->Volume && Voice.PlayOrder < Best->PlayOrder))
+            : Voice.PlayOrder < Best->PlayOrder;
+        if (bBetter)
+        {
+            Best = &Voice;
+        }
+    }
+    return Best;
+}
+
+bool USoundManager::IsVoiceActive(const FSoundVoice& Voice)
+{
+    return Voice.AudioComponent && Voice.AudioComponent->IsPlaying();
+}
+
+// 処理の流れ:
+// 1. 終わったボイスを探す
+// 2. ループ指定のボイスで、まだ次の再生が始まっていなければ頭から鳴らし直す
+//    （SoundWave の bLooping はアセット共有なので書き換えず、ボイスごとにループさせる）
+// 3. ボイス数の統計を更新
+void USoundManager::OnVoiceFinished(UAudioComponent* AudioComponent)
+{
+    for (auto& soundMap : SoundDataMap)
+    {
+        for (FSoundVoice& Voice : soundMap.Value.Voices)
+        {
+            if (Voice.AudioComponent != AudioComponent)
+                continue;
+
+            if (Voice.bLooping && AudioComponent->Sound && !AudioComponent->IsPlaying())
+            {
+                AudioComponent->Play();
+                Voice.StartTime = GetWorld() ? GetWorld()->GetAudioTimeSeconds() : 0.0;
+            }
+            break;
+        }
+    }
+
+    UpdateVoiceStats();
+}
+
+void USoundManager::UpdateVoiceStats() const
+{
+    SET_DWORD_STAT(STAT_SEActiveVoices, GetActiveVoiceCount(ESoundKinds::SE));
+}
+
+
+// =======================
+// 読み込み・メモリ予算
+// =======================
+
+void USoundManager::RequestSoundLoad(ESoundKinds SoundType, FName SoundName)
+{
+    FSoundData* SoundData = SoundDataMap.Find(SoundType);
+    if (!SoundData || SoundData->ResidencyMap.Contains(SoundName))
+        return;
+
+    const TSoftObjectPtr<USoundBase>* SoundAsset = SoundData->SoundAssetMap.Find(SoundName);
+    if (!SoundAsset || SoundAsset->IsNull())
+        return;
+
+    FSoundResidency& Residency = SoundData->ResidencyMap.Add(SoundName);
+    Residency.LastUsedOrder = NextSoundUseOrder++;
+
+    // 読み込み済みでもハンドルを持って常駐を管理する（完了通知はすぐに来る）
+    Residency.LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        SoundAsset->ToSoftObjectPath(),
+        FStreamableDelegate::CreateUObject(this, &USoundManager::OnSoundLoaded, SoundType, SoundName),
+        SoundLoadPriority);
+}
+
+void USoundManager::OnSoundLoaded(ESoundKinds SoundType, FName SoundName)
+{
+    FSoundData* SoundData = SoundDataMap.Find(SoundType);
+    if (!SoundData)
+        return;
+
+    FSoundResidency* Residency = SoundData->ResidencyMap.Find(SoundName);
+    USoundBase* Sound = SoundData->SoundAssetMap.FindRef(SoundName).Get();
+    if (!Residency || !Sound)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SoundManager: Failed to load %s"), *SoundName.ToString());
+        SoundData->ResidencyMap.Remove(SoundName);
+        return;
+    }
+
+    Residency->SizeBytes = Sound->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+    Residency->LoadedTime = GetWorld() ? GetWorld()->GetRealTimeSeconds() : 0.0;
+    INC_MEMORY_STAT_BY(STAT_SEResidentMemory, Residency->SizeBytes);
+
+    FlushPendingPlays(SoundType, SoundName);
+    EnforceMemoryBudget();
+}
+
+void USoundManager::EnforceMemoryBudget()
+{
+    if (AudioMemoryBudgetMB <= 0.0f)
+        return;
+
+    const int64 BudgetBytes = static_cast<int64>(AudioMemoryBudgetMB * 1024.0f * 1024.0f);
+    const double Now = GetWorld() ? GetWorld()->GetRealTimeSeconds() : 0.0;
+
+    int64 TotalBytes = 0;
+    for (const auto& soundMap : SoundDataMap)
+    {
+        for (const auto& residencyPair : soundMap.Value.ResidencyMap)
+        {
+            TotalBytes += residencyPair.Value.SizeBytes;
+        }
+    }
+
+    while (TotalBytes > BudgetBytes)
+    {
+        // 使う予定のない読み込み済みサウンドのうち、最も長く使われていないものを探す
+        FSoundData* EvictData = nullptr;
+        FName EvictName;
+        const FSoundResidency* EvictResidency = nullptr;
+
+        for (auto& soundMap : SoundDataMap)
+        {
+            FSoundData& soundData = soundMap.Value;
+            for (const auto& residencyPair : soundData.ResidencyMap)
+            {
+                const FSoundResidency& Residency = residencyPair.Value;
+                if (Residency.SizeBytes <= 0)
+                    continue;
+                if (EvictResidency && Residency.LastUsedOrder >= EvictResidency->LastUsedOrder)
+                    continue;
+
+                // 読み込んだ直後（再生待ち・巻き戻し用の先読みなど）は残す
+                if (Now - Residency.LoadedTime < MinResidencySeconds)
+                    continue;
+
+                const FName& Name = residencyPair.Key;
+                const ESoundKinds Kind = soundMap.Key;
+                const bool bPending = PendingPlays.ContainsByPredicate([&](const FSoundPlayRequest& Pending)
+                {
+                    return Pending.SoundType == Kind && Pending.SoundName == Name;
+                });
+                const bool bVirtual = VirtualSounds.ContainsByPredicate([&](const FVirtualSound& VirtualSound)
+                {
+                    return VirtualSound.Request.SoundType == Kind && VirtualSound.Request.SoundName == Name;
+                });
+                if (bPending || bVirtual)
+                    continue;
+
+                const bool bPlaying = soundData.Voices.ContainsByPredicate([&](const FSoundVoice& Voice)
+                {
+                    return Voice.SoundName == residencyPair.Key && IsVoiceActive(Voice);
+                });
+                if (bPlaying)
+                    continue;
+
+                EvictData = &soundData;
+                EvictName = residencyPair.Key;
+                EvictResidency = &Residency;
+            }
+        }
+
+        // 全て再生中なら予算を超えたままにする
+        if (!EvictData)
+            break;
+
+        TotalBytes -= EvictResidency->SizeBytes;
+        ReleaseSound(*EvictData, EvictName);
+    }
+}
+
+void USoundManager::ReleaseSound(FSoundData& SoundData, FName SoundName)
+{
+    FSoundResidency Residency;
+    if (!SoundData.ResidencyMap.RemoveAndCopyValue(SoundName, Residency))
+        return;
+
+    // 止まっているボイスが参照を持ったままだと解放されないので外す
+    for (FSoundVoice& Voice : SoundData.Voices)
+    {
+        if (Voice.SoundName == SoundName && !IsVoiceActive(Voice))
+        {
+            Voice.AudioComponent->SetSound(nullptr);
+            Voice.SoundName = NAME_None;
+        }
+    }
+
+    if (Residency.LoadHandle.IsValid())
+    {
+        Residency.LoadHandle->ReleaseHandle();
+    }
+
+    DEC_MEMORY_STAT_BY(STAT_SEResidentMemory, Residency.SizeBytes);
+    UE_LOG(LogTemp, Verbose, TEXT("SoundManager: Released %s (%lld bytes)"), *SoundName.ToString(), Residency.SizeBytes);
+}
+
+bool USoundManager::QueuePendingPlay(const FSoundPlayRequest& Request)
+{
+    // 同じサウンドは最初のリクエストだけを残す
+    const bool bAlreadyQueued = PendingPlays.ContainsByPredicate([&](const FSoundPlayRequest& Pending)
+    {
+        return Pending.SoundType == Request.SoundType && Pending.SoundName == Request.SoundName;
+    });
+    if (bAlreadyQueued)
+        return true;
+
+    if (PendingPlays.Num() >= MaxPendingPlays)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("SoundManager: Pending play queue is full, %s skipped"), *Request.SoundName.ToString());
+        return false;
+    }
+
+    FSoundPlayRequest& Pending = PendingPlays.Add_GetRef(Request);
+    Pending.RequestTime = GetWorld() ? GetWorld()->GetRealTimeSeconds() : 0.0;
+    return true;
+}
+
+void USoundManager::FlushPendingPlays(ESoundKinds SoundType, FName SoundName)
+{
+    const int32 Index = PendingPlays.IndexOfByPredicate([&](const FSoundPlayRequest& Pending)
+    {
+        return Pending.SoundType == SoundType && Pending.SoundName == SoundName;
+    });
+    if (Index == INDEX_NONE)
+        return;
+
+    const FSoundPlayRequest Request = PendingPlays[Index];
+    PendingPlays.RemoveAtSwap(Index);
+
+    // 間に合わなかった再生は鳴らさない（遅れて鳴ると不自然なため）
+    const double Now = GetWorld() ? GetWorld()->GetRealTimeSeconds() : 0.0;
+    if (Now - Request.RequestTime > PendingPlayTimeout)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("SoundManager: %s loaded too late, skipped"), *SoundName.ToString());
+        return;
+    }
+
+    PlayVoice(Request.SoundType, Request.SoundName, Request.bLoop, Request.bSetVolume, Request.Volume,
+        Request.bSpecifyLocation, Request.Location, Request.bOverrideAttenuation ? &Request.Attenuation : nullptr);
+}
+
+
+// =======================
+// 時間倍率
+// =======================
+
+void USoundManager::OnTimeDilationChanged(float TimeDilation)
+{
+    CurrentTimeDilation = TimeDilation;
+    const float Pitch = GetTimeDilationPitch();
+
+    // 再生中のSEのピッチをまとめて更新
+    for (auto& soundMap : SoundDataMap)
+    {
+        for (FSoundVoice& Voice : soundMap.Value.Voices)
+        {
+            if (Voice.bFollowTimeDilation && IsVoiceActive(Voice))
+            {
+                Voice.AudioComponent->SetPitchMultiplier(Pitch);
+            }
+        }
+    }
+
+    // BGMは FMOD のグローバルパラメータで時間倍率を伝える
+    if (!BGMTimeScaleParameter.IsNone() && IFMODStudioModule::IsAvailable())
+    {
+        if (FMOD::Studio::System* StudioSystem = IFMODStudioModule::Get().GetStudioSystem(EFMODSystemContext::Runtime))
+        {
+            StudioSystem->setParameterByName(TCHAR_TO_UTF8(*BGMTimeScaleParameter.ToString()), TimeDilation);
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("SoundManager: Time dilation %.2f applied (SE pitch %.2f)"), TimeDilation, Pitch);
+}
+
+float USoundManager::GetTimeDilationPitch() const
+{
+    // エンジンのピッチ上限（2.0）を超えないようにする
+    return FMath::Clamp(CurrentTimeDilation, MinTimeDilationPitch, 2.0f);
+}
+
+
+// =======================
+// 巻き戻し
+// =======================
+
+void USoundManager::RecordSoundEvent(ESoundKinds SoundType, FName SoundName, float Volume, bool IsSpecifyLocation, const FVector& place)
+{
+    if (SoundEventLog.Num() == 0 || !GetWorld())
+        return;
+
+    FSoundEventRecord& Record = SoundEventLog[SoundEventLogWriteIndex];
+    Record.Time = GetWorld()->GetTimeSeconds();
+    Record.SoundName = SoundName;
+    Record.Location = FVector3f(place);
+    Record.Volume = static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(Volume, 0.0f, 1.0f) * 255.0f));
+    Record.SoundType = SoundType;
+    Record.bSpecifyLocation = IsSpecifyLocation;
+
+    SoundEventLogWriteIndex = (SoundEventLogWriteIndex + 1) % SoundEventLog.Num();
+    SoundEventLogCount = FMath::Min(SoundEventLogCount + 1, SoundEventLog.Num());
+}
+
+void USoundManager::OnRewindPlaybackChanged(bool bRewinding, float PlaybackRate)
+{
+    if (!bRewinding)
+    {
+        // 巻き戻し後は記録をやり直す（時間操作のスナップショットと同じ）
+        bRewindPlaybackActive = false;
+        SoundEventLogWriteIndex = 0;
+        SoundEventLogCount = 0;
+        RewindSoundTriggers.Reset();
+        RewindSoundTriggerCursor = 0;
+        return;
+    }
+
+    const float PreviousRate = RewindPlaybackRate;
+    RewindPlaybackRate = FMath::Max(PlaybackRate, KINDA_SMALL_NUMBER);
+    if (bRewindPlaybackActive)
+    {
+        // 速さが変わると鳴らし始める時刻も変わる（通り過ぎた分はループ側で飛ばす）
+        if (!FMath::IsNearlyEqual(PreviousRate, RewindPlaybackRate))
+        {
+            BuildRewindSoundTriggers();
+        }
+        return;
+    }
+
+    bRewindPlaybackActive = true;
+
+    // 逆再生版を先に読み込んでおく
+    for (int32 Index = 0; Index < SoundEventLogCount; ++Index)
+    {
+        const FSoundEventRecord& Record = SoundEventLog[Index];
+        const FSoundData* SoundData = SoundDataMap.Find(Record.SoundType);
+        const FSoundVoiceSettings* Settings = SoundData ? SoundData->VoiceSettingsMap.Find(Record.SoundName) : nullptr;
+        if (Settings && !Settings->ReversedSound.IsNone())
+        {
+            RequestSoundLoad(Record.SoundType, Settings->ReversedSound);
+        }
+    }
+
+    BuildRewindSoundTriggers();
+    ReverseSoundEventsLoop();
+}
+
+float USoundManager::GetRewindSoundPitch() const
+{
+    // 時間倍率のピッチと同じ範囲（エンジンのピッチ上限は 2.0）
+    return FMath::Clamp(RewindPlaybackRate, MinTimeDilationPitch, 2.0f);
+}
+
+// 処理の流れ:
+// 1. 逆再生版がある記録ごとに音の長さを取得（逆再生版が未読み込みなら同じ長さの元の音）
+// 2. 逆再生版をピッチ付きで鳴らしたとき、元の開始時刻でちょうど鳴り終わる記録時刻を求める
+// 3. 新しい順に並べ、カーソルを先頭に戻す
+void USoundManager::BuildRewindSoundTriggers()
+{
+    RewindSoundTriggers.Reset();
+    RewindSoundTriggerCursor = 0;
+
+    // ピッチ Pitch で鳴らすと実時間で Duration / Pitch かかり、その間に記録時間は RewindPlaybackRate 倍で戻る
+    // （速さがピッチの範囲外でもピッチに合わせて鳴らし始めを前後させ、終わりは元の開始時刻に揃える）
+    const float RecordTimePerSoundTime = RewindPlaybackRate / GetRewindSoundPitch();
+
+    for (int32 Index = 0; Index < SoundEventLogCount; ++Index)
+    {
+        const FSoundEventRecord& Record = SoundEventLog[Index];
+
+        const FSoundData* SoundData = SoundDataMap.Find(Record.SoundType);
+        const FSoundVoiceSettings* Settings = SoundData ? SoundData->VoiceSettingsMap.Find(Record.SoundName) : nullptr;
+        if (!Settings || Settings->ReversedSound.IsNone())
+            continue;
+
+        const USoundBase* Sound = SoundData->SoundAssetMap.FindRef(Settings->ReversedSound).Get();
+        if (!Sound)
+        {
+            Sound = SoundData->SoundAssetMap.FindRef(Record.SoundName).Get();
+        }
+
+        const float Duration = Sound ? Sound->GetDuration() : 0.0f;
+        if (Duration <= 0.0f || Duration >= INDEFINITELY_LOOPING_DURATION)
+            continue;
+
+        FRewindSoundTrigger& Trigger = RewindSoundTriggers.AddDefaulted_GetRef();
+        Trigger.TriggerTime = Record.Time + Duration * RecordTimePerSoundTime;
+        Trigger.RecordIndex = Index;
+    }
+
+    RewindSoundTriggers.Sort([](const FRewindSoundTrigger& A, const FRewindSoundTrigger& B)
+    {
+        return A.TriggerTime > B.TriggerTime;
+    });
+}
+
+// 処理の流れ:
+// 1. 毎フレーム、巻き戻した先の時刻を速さに応じて戻す
+// 2. 新しい順のトリガーをカーソルから順に見て、今フレームで通り過ぎたものを鳴らす
+// 3. カーソルより前は二度と見ない（巻き戻し中は時刻が戻る一方）
+TCoroutine<> USoundManager::ReverseSoundEventsLoop()
+{
+    if (!GetWorld())
+        co_return;
+
+    // 巻き戻した先の時刻（記録と同じワールド時間）
+    double RewindTime = GetWorld()->GetTimeSeconds();
+
+    while (bRewindPlaybackActive)
+    {
+        co_await NextTick();
+
+        if (!bRewindPlaybackActive || !GetWorld())
+            break;
+
+        const double PreviousRewindTime = RewindTime;
+        RewindTime -= GetWorld()->GetDeltaSeconds() * RewindPlaybackRate;
+
+        const float Pitch = GetRewindSoundPitch();
+
+        while (RewindSoundTriggerCursor < RewindSoundTriggers.Num())
+        {
+            const FRewindSoundTrigger Trigger = RewindSoundTriggers[RewindSoundTriggerCursor];
+            if (Trigger.TriggerTime <= RewindTime)
+                break;
+
+            ++RewindSoundTriggerCursor;
+
+            // 巻き戻し開始時にまだ鳴っていた音、作り直す前に通り過ぎた音は鳴らさない
+            if (Trigger.TriggerTime > PreviousRewindTime)
+                continue;
+
+            const FSoundEventRecord& Record = SoundEventLog[Trigger.RecordIndex];
+            const FSoundData* SoundData = SoundDataMap.Find(Record.SoundType);
+            const FSoundVoiceSettings* Settings = SoundData ? SoundData->VoiceSettingsMap.Find(Record.SoundName) : nullptr;
+            if (!Settings || Settings->ReversedSound.IsNone())
+                continue;
+
+            PlayVoice(Record.SoundType, Settings->ReversedSound, false, true, Record.Volume / 255.0f,
+                Record.bSpecifyLocation, FVector(Record.Location), nullptr, Pitch);
+        }
+    }
+}
+
+
+// =======================
+// 仮想化
+// =======================
+
+float USoundManager::GetAudibleRadius(const FSoundData& SoundData, const FSoundVoiceSettings& Settings, const FSoundAttenuationSettings* AttenuationOverride) const
+{
+    if (AttenuationOverride)
+    {
+        return AttenuationOverride->bAttenuate ? AttenuationOverride->GetMaxDimension() : 0.0f;
+    }
+
+    const USoundAttenuation* Attenuation = FindAttenuation(SoundData, Settings.AttenuationPreset);
+    return Attenuation && Attenuation->Attenuation.bAttenuate ? Attenuation->Attenuation.GetMaxDimension() : 0.0f;
+}
+
+bool USoundManager::IsWithinAudibleRange(const FVector& Location, float AudibleRadius, float Margin) const
+{
+    // 減衰しない音は常に聞こえる
+    if (AudibleRadius <= 0.0f)
+        return true;
+
+    const APlayerController* PlayerController = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+    if (!PlayerController)
+        return true;
+
+    FVector ListenerLocation;
+    FVector ListenerFront;
+    FVector ListenerRight;
+    PlayerController->GetAudioListenerPosition(ListenerLocation, ListenerFront, ListenerRight);
+
+    const float Radius = AudibleRadius * Margin;
+    return FVector::DistSquared(ListenerLocation, Location) <= Radius * Radius;
+}
+
+bool USoundManager::VirtualizeSound(const FSoundPlayRequest& Request, const USoundBase* Sound, float AudibleRadius, int32 Priority, float ElapsedTime)
+{
+    if (!Sound || !GetWorld())
+        return false;
+
+    // 短いワンショットは追う意味がないので破棄
+    const float Duration = Sound->GetDuration();
+    if (!Request.bLoop && Duration - ElapsedTime < MinVirtualDuration)
+        return false;
+
+    if (VirtualSounds.Num() >= MaxVirtualSounds)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("SoundManager: Virtual sound limit reached, %s skipped"), *Request.SoundName.ToString());
+        return false;
+    }
+
+    FVirtualSound& VirtualSound = VirtualSounds.AddDefaulted_GetRef();
+    VirtualSound.Request = Request;
+    VirtualSound.StartTime = GetWorld()->GetAudioTimeSeconds() - ElapsedTime;
+    VirtualSound.Duration = Duration;
+    VirtualSound.AudibleRadius = AudibleRadius;
+    VirtualSound.Priority = Priority;
+    SET_DWORD_STAT(STAT_SEVirtualSounds, VirtualSounds.Num());
+
+    if (!bVirtualLoopRunning)
+    {
+        UpdateVirtualSounds();
+    }
     return true;
 }
 
+// 処理の流れ:
+// 1. 一定間隔（実時間）を待つ
+// 2. 範囲外に出たループ音を仮想化してボイスを空ける
+// 3. 仮想化したサウンドの期限切れを削除し、聞こえる範囲に入ったものを続きから再生
+TCoroutine<> USoundManager::UpdateVirtualSounds()
+{
+    bVirtualLoopRunning = true;
+
+    float Elapsed = 0.0f;
+    while (true)
+    {
+        co_await NextTick();
+
+        UWorld* World = GetWorld();
+        if (!World)
+            break;
+
+        Elapsed += World->DeltaRealTimeSeconds;
+        if (Elapsed < VirtualUpdateInterval)
+            continue;
+        Elapsed = 0.0f;
+
+        const double Now = World->GetAudioTimeSeconds();
+
+        // 範囲外に出たループ音を仮想化
+        for (auto& soundMap : SoundDataMap)
+        {
+            for (FSoundVoice& Voice : soundMap.Value.Voices)
+            {
+                if (!Voice.bLooping || !Voice.Request.bSpecifyLocation || !IsVoiceActive(Voice))
+                    continue;
+                if (IsWithinAudibleRange(Voice.Request.Location, Voice.AudibleRadius, VirtualizeDistanceMargin))
+                    continue;
+
+                if (VirtualizeSound(Voice.Request, Voice.AudioComponent->Sound, Voice.AudibleRadius, Voice.Priority, static_cast<float>(Now - Voice.StartTime)))
+                {
+                    Voice.bLooping = false;
+                    Voice.AudioComponent->Stop();
+                }
+            }
+        }
+
+        // 期限切れを削除し、聞こえる範囲に入ったものを復帰
+        TArray<FVirtualSound, TInlineAllocator<8>> Promoted;
+        for (int32 Index = VirtualSounds.Num() - 1; Index >= 0; --Index)
+        {
+            const FVirtualSound& VirtualSound = VirtualSounds[Index];
+            const float PlayedTime = static_cast<float>(Now - VirtualSound.StartTime);
+
+            if (!VirtualSound.Request.bLoop && PlayedTime >= VirtualSound.Duration)
+            {
+                VirtualSounds.RemoveAtSwap(Index);
+                continue;
+            }
+
+            if (!VirtualSound.Request.bSpecifyLocation || IsWithinAudibleRange(VirtualSound.Request.Location, VirtualSound.AudibleRadius))
+            {
+                Promoted.Add(VirtualSound);
+                VirtualSounds.RemoveAtSwap(Index);
+            }
+        }
+
+        // 優先度の高いものから復帰（ボイスが足りなければ再び仮想化される）
+        Promoted.Sort([](const FVirtualSound& A, const FVirtualSound& B) { return A.Priority > B.Priority; });
+        for (const FVirtualSound& VirtualSound : Promoted)
+        {
+            const FSoundPlayRequest& Request = VirtualSound.Request;
+            float Offset = static_cast<float>(Now - VirtualSound.StartTime);
+            if (Request.bLoop && VirtualSound.Duration > 0.0f)
+            {
+                Offset = FMath::Fmod(Offset, VirtualSound.Duration);
+            }
+
+            PlayVoice(Request.SoundType, Request.SoundName, Request.bLoop, Request.bSetVolume, Request.Volume,
+                Request.bSpecifyLocation, Request.Location, Request.bOverrideAttenuation ? &Request.Attenuation : nullptr,
+                0.0f, FMath::Max(Offset, KINDA_SMALL_NUMBER));
+        }
+
+        SET_DWORD_STAT(STAT_SEVirtualSounds, VirtualSounds.Num());
+
+        if (!HasVirtualizationWork())
+            break;
+    }
+
+    bVirtualLoopRunning = false;
+}
+
+bool USoundManager::HasVirtualizationWork() const
+{
+    if (VirtualSounds.Num() > 0)
+        return true;
+
+    for (const auto& soundMap : SoundDataMap)
+    {
+        for (const FSoundVoice& Voice : soundMap.Value.Voices)
+        {
+            if (Voice.bLooping && Voice.Request.bSpecifyLocation && IsVoiceActive(Voice))
+                return true;
+        }
+    }
+    return false;
+}
+
+
+// =======================
+// 距離減衰
+// =======================
+
+void USoundManager::CreateAttenuationPresets(FSoundData& SoundData)
+{
+    SoundData.AttenuationAssetMap.Reset();
+
+    for (const auto& presetPair : SoundData.AttenuationPresetMap)
+    {
+        if (presetPair.Key.IsNone())
+            continue;
+
+        USoundAttenuation* Attenuation = NewObject<USoundAttenuation>(this);
+        Attenuation->Attenuation = presetPair.Value;
+        SoundData.AttenuationAssetMap.Add(presetPair.Key, Attenuation);
+    }
+}
+
+USoundAttenuation* USoundManager::FindAttenuation(const FSoundData& SoundData, FName PresetName) const
+{
+    if (!PresetName.IsNone())
+    {
+        if (USoundAttenuation* const* Found = SoundData.AttenuationAssetMap.Find(PresetName))
+        {
+            return *Found;
+        }
+
+        UE_LOG(LogTemp, Warning, TEXT("SoundManager: Attenuation preset %s not found"), *PresetName.ToString());
+    }
+
+    return DefaultAttenuation;
+}
+
 
 // =======================
 // BGM 制御
@@ -209,31 +1176,31 @@ void USoundManager::StopSE(FName SoundName)
         return;
     }
 
-    // ループSEに登録されているかチェック
-    UAudioComponent** FoundCompPtr = LoopSEMap.Find(SoundName);
-    if (!FoundCompPtr)
-    {
-        return; // ループしていないSEなので無視
-    }
-
-    UAudioComponent* AudioComponent = *FoundCompPtr;
-    if (AudioComponent)
+    // ループ再生中のボイスを止める（ループしていないSEは無視）
+    for (auto& soundMap : SoundDataMap)
     {
-        // 再生中なら停止
-        if (AudioComponent->IsPlaying())
+        for (FSoundVoice& Voice : soundMap.Value.Voices)
         {
-            AudioComponent->Stop();
-        }
+            if (!Voice.bLooping || Voice.SoundName != SoundName)
+            {
+                continue;
+            }
 
-        // ループ解除（SoundWave の場合）
-        if (USoundWave* SoundWave = Cast<USoundWave>(AudioComponent->Sound))
-        {
-            SoundWave->bLooping = false;
+            // 先にループを解除してから停止（終了通知で鳴らし直さないように）
+            Voice.bLooping = false;
+            if (IsVoiceActive(Voice))
+            {
+                Voice.AudioComponent->Stop();
+            }
         }
     }
 
-    // マップから削除
-    LoopSEMap.Remove(SoundName);
+    // 仮想化中のループ音も止める
+    VirtualSounds.RemoveAll([SoundName](const FVirtualSound& VirtualSound)
+    {
+        return VirtualSound.Request.bLoop && VirtualSound.Request.SoundName == SoundName;
+    });
+    SET_DWORD_STAT(STAT_SEVirtualSounds, VirtualSounds.Num());
 }
 
 bool USoundManager::PlayBGM()
@@ -260,17 +1227,97 @@ bool USoundManager::PlayBGM()
             return false;
         }
         BGM->RegisterComponent();
+
+        // ビート・マーカーはコンポーネント自身のコールバックがゲームスレッドへ運ぶので、そのデリゲートを受け取る
+        BGM->bEnableTimelineCallbacks = true;
+        BGM->OnTimelineBeat.AddDynamic(this, &USoundManager::OnBGMTimelineBeat);
+        BGM->OnTimelineMarker.AddDynamic(this, &USoundManager::OnBGMTimelineMarker);
     }
 
 
     // BGM再生
     BGM->SetEvent(BGMEventAsset);
     BGM->SetVolume(BGMVolume);
+    PlayBGMInstance();
+    return true;
+}
+
+// =======================
+// BGM タイムライン
+// =======================
+
+// 処理の流れ:
+// 1. 再生（コンポーネントが新しいインスタンスを作り、タイムラインのコールバックも付け直す）
+// 2. 新しいインスタンスを保持し、ビート番号を0に戻す
+// 3. DSP クロック換算用にサンプルレートを取得
+void USoundManager::PlayBGMInstance()
+{
     BGM->Play();
 
     EventInstance = BGM->StudioInstance;
     StartTime = GetWorld()->GetTimeSeconds();
-    return true;
+    NextBGMBeatIndex = 0;
+
+    if (BGMSampleRate <= 0)
+    {
+        FMOD::Studio::System* StudioSystem = IFMODStudioModule::Get().GetStudioSystem(EFMODSystemContext::Runtime);
+        FMOD::System* CoreSystem = nullptr;
+        if (StudioSystem && StudioSystem->getCoreSystem(&CoreSystem) == FMOD_OK && CoreSystem)
+        {
+            CoreSystem->getSoftwareFormat(&BGMSampleRate, nullptr, nullptr);
+        }
+    }
+}
+
+void USoundManager::OnBGMTimelineBeat(int32 Bar, int32 Beat, int32 Position, float Tempo, int32 TimeSignatureUpper, int32 TimeSignatureLower)
+{
+    FBGMTimelineEvent TimelineEvent;
+    TimelineEvent.Type = EBGMTimelineEventType::Beat;
+    TimelineEvent.BeatIndex = NextBGMBeatIndex++;
+    TimelineEvent.Bar = Bar;
+    TimelineEvent.Beat = Beat;
+    TimelineEvent.Tempo = Tempo;
+    TimelineEvent.TimelinePositionMs = Position;
+    TimelineEvent.EstimatedDSPClock = EstimateBGMDSPClockAt(Position);
+
+    OnBGMTimelineEvent.Broadcast(TimelineEvent);
+}
+
+void USoundManager::OnBGMTimelineMarker(FString Name, int32 Position)
+{
+    FBGMTimelineEvent TimelineEvent;
+    TimelineEvent.Type = EBGMTimelineEventType::Marker;
+    TimelineEvent.BeatIndex = FMath::Max(NextBGMBeatIndex - 1, 0);
+    TimelineEvent.TimelinePositionMs = Position;
+    TimelineEvent.EstimatedDSPClock = EstimateBGMDSPClockAt(Position);
+    TimelineEvent.MarkerName = FName(*Name);
+
+    OnBGMTimelineEvent.Broadcast(TimelineEvent);
+}
+
+// 処理の流れ:
+// 1. イベントのチャンネルグループの現在の DSP クロックと、現在のタイムライン位置を取得
+// 2. 指定位置までの差（ミリ秒）をサンプル数に換算して現在のクロックから引く
+//    （差がミリ秒単位なので、結果はミリ秒精度の推定値）
+uint64 USoundManager::EstimateBGMDSPClockAt(int32 TimelinePositionMs) const
+{
+    if (!EventInstance || !EventInstance->isValid() || BGMSampleRate <= 0)
+    {
+        return 0;
+    }
+
+    FMOD::ChannelGroup* ChannelGroup = nullptr;
+    unsigned long long CurrentClock = 0;
+    int32 CurrentPositionMs = 0;
+    if (EventInstance->getChannelGroup(&ChannelGroup) != FMOD_OK || !ChannelGroup
+        || ChannelGroup->getDSPClock(&CurrentClock, nullptr) != FMOD_OK
+        || EventInstance->getTimelinePosition(&CurrentPositionMs) != FMOD_OK)
+    {
+        return 0;
+    }
+
+    const int64 ElapsedSamples = static_cast<int64>(CurrentPositionMs - TimelinePositionMs) * BGMSampleRate / 1000;
+    return static_cast<uint64>(FMath::Max<int64>(static_cast<int64>(CurrentClock) - ElapsedSamples, 0));
 }
 
 void USoundManager::PauseBGM()
@@ -3,28 +3,279 @@
 #include "CoreMinimal.h"
 #include "Components/AudioComponent.h"
 #include "Components/ActorComponent.h"
+#include "Engine/StreamableManager.h"
+#include "Sound/SoundAttenuation.h"
 #include "Interface/Soundable.h"
 #include "fmod_studio.hpp"     // FMOD Studio APIのC++ラッパー
+#include "UE5Coro.h"
 #include "SoundManager.generated.h"
 
 class UFMODAudioComponent;
 class UFMODEvent;
 
+// 空きボイスがないときに奪うボイスの選び方
+UENUM()
+enum class ESoundVoiceStealMode : uint8
+{
+    Oldest      UMETA(DisplayName = "Oldest"),
+    Quietest    UMETA(DisplayName = "Quietest"),
+};
+
+// サウンドが従う時間
+UENUM()
+enum class ESoundTimeDomain : uint8
+{
+    // ワールドの時間倍率に合わせてピッチを変える
+    World   UMETA(DisplayName = "World"),
+
+    // 時間倍率の影響を受けない（UIなど）
+    Real    UMETA(DisplayName = "Real"),
+};
+
+// SE再生要求の結果
+UENUM()
+enum class ESoundPlayResult : uint8
+{
+    // 再生できなかった（未登録・ボイス不足・読み込み待ちが満杯など）
+    Failed  UMETA(DisplayName = "Failed"),
+
+    // 再生した（聞こえない距離・ボイス不足で仮想化した場合も含む）
+    Played  UMETA(DisplayName = "Played"),
+
+    // 読み込み待ち。読み込みが間に合えば再生する
+    Pending UMETA(DisplayName = "Pending"),
+};
+
+// サウンドごとの発音設定
+USTRUCT()
+struct FSoundVoiceSettings
+{
+    GENERATED_USTRUCT_BODY()
+public:
+    // 同時に鳴らせる数（超えると同じサウンドの一番古いボイスを奪う）
+    UPROPERTY(EditAnywhere, Category = "Sound", meta = (ClampMin = "1"))
+    int32 MaxPolyphony = 2;
+
+    // 優先度（ボイスが足りないときは低いものから奪われる）
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    int32 Priority = 0;
+
+    // 位置指定再生で使う距離減衰プリセット名（None なら既定の距離減衰）
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    FName AttenuationPreset;
+
+    // 従う時間（Real ならスローモーション中もピッチを変えない）
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    ESoundTimeDomain TimeDomain = ESoundTimeDomain::World;
+
+    // 巻き戻し時に鳴らす逆再生版（同じカテゴリのサウンド名、None なら巻き戻しでは鳴らさない）
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    FName ReversedSound;
+};
+
+// 再生リクエスト（読み込み待ち・仮想化からの復帰で同じ引数で再生し直すために保持）
+struct FSoundPlayRequest
+{
+    ESoundKinds SoundType = ESoundKinds::SE;
+    FName SoundName;
+    bool bLoop = false;
+    bool bSetVolume = false;
+    float Volume = 1.0f;
+    bool bSpecifyLocation = false;
+    FVector Location = FVector::ZeroVector;
+    bool bOverrideAttenuation = false;
+    FSoundAttenuationSettings Attenuation;
+
+    // リクエストした時刻（実時間）
+    double RequestTime = 0.0;
+};
+
+// プールされたボイス（AudioComponent 1つ分）
+USTRUCT()
+struct FSoundVoice
+{
+    GENERATED_USTRUCT_BODY()
+public:
+    UPROPERTY(Transient)
+    UAudioComponent* AudioComponent = nullptr;
+
+    // 再生中のサウンド名
+    FName SoundName;
+
+    int32 Priority = 0;
+
+    float Volume = 0.0f;
+
+    // 再生を始めた順番（小さいほど古い）
+    uint64 PlayOrder = 0;
+
+    // ループ再生か（終了通知で頭から鳴らし直す。停止するときは先に false にする）
+    bool bLooping = false;
+
+    // ワールドの時間倍率に合わせてピッチを変えるか
+    bool bFollowTimeDilation = true;
+
+    // 聞こえる距離（位置指定再生のみ）
+    float AudibleRadius = 0.0f;
+
+    // 再生を始めた時刻（オーディオ時間、仮想化したときの再生位置に使う）
+    double StartTime = 0.0;
+
+    // 再生したときの引数（仮想化・復帰用）
+    FSoundPlayRequest Request;
+};
+
+// 仮想化したサウンド（鳴らさずにタイミングだけを追う）
+struct FVirtualSound
+{
+    FSoundPlayRequest Request;
+
+    // 鳴り始めたはずの時刻（オーディオ時間）
+    double StartTime = 0.0;
+
+    // 長さ（ループなら1周分）
+    float Duration = 0.0f;
+
+    // 聞こえる距離（0なら距離では判定しない）
+    float AudibleRadius = 0.0f;
+
+    int32 Priority = 0;
+};
+
+// 読み込んだサウンドの常駐情報
+struct FSoundResidency
+{
+    // 読み込みハンドル（解放するとアセットがGCの対象になる）
+    TSharedPtr<FStreamableHandle> LoadHandle;
+
+    // 読み込み後のメモリサイズ
+    int64 SizeBytes = 0;
+
+    // 最後に再生した順番（小さいほど長く使われていない）
+    uint64 LastUsedOrder = 0;
+
+    // 読み込みが終わった時刻（実時間）
+    double LoadedTime = 0.0;
+};
+
+// 再生したSEの記録（巻き戻し用、1件あたり数十バイト）
+struct FSoundEventRecord
+{
+    // 再生した時刻（ワールド時間、時間操作のスナップショットと同じ時計）
+    float Time = 0.0f;
+
+    FName SoundName;
+
+    FVector3f Location = FVector3f::ZeroVector;
+
+    // 音量（0-255に量子化）
+    uint8 Volume = 0;
+
+    ESoundKinds SoundType = ESoundKinds::SE;
+
+    bool bSpecifyLocation = false;
+};
+
+// 巻き戻し中に逆再生版を鳴らし始める記録時刻
+struct FRewindSoundTrigger
+{
+    double TriggerTime = 0.0;
+
+    // SoundEventLog のインデックス
+    int32 RecordIndex = 0;
+};
+
+// レベルで事前に読み込むサウンド
+USTRUCT()
+struct FSoundPreloadList
+{
+    GENERATED_USTRUCT_BODY()
+public:
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    TArray<FName> SoundNames;
+};
+
 // サウンドデータを格納する構造体
 USTRUCT()
 struct FSoundData : public FTableRowBase
 {
     GENERATED_USTRUCT_BODY()
 public:
-    // 再生対象の音（SoundWave or SoundCue）を保持
+    // 再生対象の音（SoundWave or SoundCue）を保持（Init後に非同期で読み込む）
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    TMap<FName, TSoftObjectPtr<USoundBase>> SoundAssetMap;
+
+    // このカテゴリで事前に確保するボイス数（同時発音数の上限）
+    UPROPERTY(EditAnywhere, Category = "Sound", meta = (ClampMin = "1"))
+    int32 VoiceCount = 8;
+
+    // 空きボイスがないときに奪うボイスの選び方（同じ優先度の中で適用）
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    ESoundVoiceStealMode StealMode = ESoundVoiceStealMode::Oldest;
+
+    // 個別設定のないサウンドの発音設定
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    FSoundVoiceSettings DefaultVoiceSettings;
+
+    // サウンドごとの発音設定
     UPROPERTY(EditAnywhere, Category = "Sound")
-    TMap<FName, USoundBase*> SoundAssetMap;
+    TMap<FName, FSoundVoiceSettings> VoiceSettingsMap;
+
+    // 距離減衰プリセット（Init時に USoundAttenuation を一度だけ生成する）
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    TMap<FName, FSoundAttenuationSettings> AttenuationPresetMap;
+
+    // Init時に生成した距離減衰
+    UPROPERTY(Transient)
+    TMap<FName, USoundAttenuation*> AttenuationAssetMap;
 
-    // AudioComponent（再生時に生成される）を保持
+    // 読み込み中・読み込み済みのサウンド
+    TMap<FName, FSoundResidency> ResidencyMap;
+
+    // Init時に確保したボイス
     UPROPERTY(Transient)
-    TMap<FName, UAudioComponent*> AudioComponentMap;
+    TArray<FSoundVoice> Voices;
+};
+
+// BGMタイムラインイベントの種類
+enum class EBGMTimelineEventType : uint8
+{
+    Beat,
+    Marker,
 };
 
+// BGMのビート・マーカー（ゲームスレッドに通知する形）
+// FMOD のミキサーで起きてから、コンポーネントがゲームスレッドで通知するまで最大1フレーム遅れる
+// （イベントインスタンスのコールバックは1つしか付けられず、UFMODAudioComponent が使っているため）
+// 拍に合わせる処理は EstimatedDSPClock か TimelinePositionMs を基準にし、受け取った時刻は使わないこと
+struct FBGMTimelineEvent
+{
+    EBGMTimelineEventType Type = EBGMTimelineEventType::Beat;
+
+    // BGM再生開始からのビート番号（マーカーでは直前のビート番号）
+    int32 BeatIndex = 0;
+
+    // 小節・小節内の拍（ビートのみ）
+    int32 Bar = 0;
+    int32 Beat = 0;
+
+    // テンポ（BPM、ビートのみ）
+    float Tempo = 0.0f;
+
+    // タイムライン上の位置（ミリ秒）
+    int32 TimelinePositionMs = 0;
+
+    // イベントの位置に相当する DSP クロックの推定値（単位はサンプルだが、精度はミリ秒）
+    // 受け取った時点のクロックから、現在のタイムライン位置との差を引いて求める
+    // サンプル単位で正確な値ではないので、サンプル精度のスケジュールには使わないこと
+    uint64 EstimatedDSPClock = 0;
+
+    // マーカー名（マーカーのみ）
+    FName MarkerName;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnBGMTimelineEvent, const FBGMTimelineEvent&);
+
 // サウンドを管理するクラス
 /**
  * @brief サウンド管理コンポーネント
@@ -44,6 +295,45 @@ public:
     /** @brief サウンドマネージャー初期化処理 */
     void Init();
 
+    /**
+     * @brief 指定サウンドの読み込みが終わり、再生できる状態か
+     * @param SoundType BGM or SE
+     * @param SoundName サウンド名
+     */
+    bool IsSoundReady(ESoundKinds SoundType, FName SoundName) const;
+
+    /** @brief 再生中のボイス数（プロファイル用） */
+    int32 GetActiveVoiceCount(ESoundKinds SoundType) const;
+
+    /** @brief これまでに奪ったボイスの数（プロファイル用） */
+    int32 GetStolenVoiceCount() const { return StolenVoiceCount; }
+
+    /** @brief 仮想化中のサウンド数（プロファイル用） */
+    int32 GetVirtualSoundCount() const { return VirtualSounds.Num(); }
+
+    /**
+     * @brief BGMのビート・マーカー（BGMの UFMODAudioComponent がゲームスレッドで通知したものを中継）
+     * @details 通知は最大1フレーム遅れる。タイミングはイベントの EstimatedDSPClock（ミリ秒精度）で補正する
+     */
+    FOnBGMTimelineEvent OnBGMTimelineEvent;
+
+    /**
+     * @brief 距離減衰を指定して位置再生
+     * @details 設定は割り当てたボイスの AttenuationOverrides に書き込むため、UObject を生成しない
+     * @param SoundType BGM以外
+     * @param SoundName サウンド名
+     * @param Location 再生位置
+     * @param Attenuation この再生だけに使う距離減衰
+     * @param isLoop ループ再生させるか
+     * @return bool 再生したか、読み込み完了後に再生する予定なら true
+     */
+    bool PlaySoundWithAttenuation(
+        ESoundKinds SoundType,
+        FName SoundName,
+        FVector Location,
+        const FSoundAttenuationSettings& Attenuation,
+        bool isLoop = false);
+
 private:
     // ==========================
     // ==== ボリューム管理関数 ===
@@ -101,7 +391,7 @@ private:
      * @param Volume 音量（0-1）
      * @param IsSpecifyLocation 指定位置で再生するか
      * @param place 再生位置（IsSpecifyLocation=true時に使用）
-     * @return bool 再生成功か否か
+     * @return bool 再生したか、読み込み完了後に再生する予定なら true
      */
 
     virtual bool PlaySound(
@@ -116,6 +406,177 @@ private:
     /** @brief BGM再生開始 */
     bool PlayBGM();
 
+    // ==========================
+    // ==== BGMタイムライン =====
+    // ==========================
+
+    /**
+     * @brief BGMのイベントインスタンスを再生し、タイムライン関連の状態を新しいインスタンスに合わせる
+     * @details UFMODAudioComponent::Play は毎回インスタンスを作り直すので、BGMの再生はすべてここを通す
+     */
+    void PlayBGMInstance();
+
+    /** @brief BGMコンポーネントのビート通知を受け取る */
+    UFUNCTION()
+    void OnBGMTimelineBeat(int32 Bar, int32 Beat, int32 Position, float Tempo, int32 TimeSignatureUpper, int32 TimeSignatureLower);
+
+    /** @brief BGMコンポーネントのマーカー通知を受け取る */
+    UFUNCTION()
+    void OnBGMTimelineMarker(FString Name, int32 Position);
+
+    /**
+     * @brief タイムライン位置に相当する DSP クロックを推定する
+     * @details タイムライン位置がミリ秒単位なので、結果もミリ秒精度（サンプル精度ではない）
+     */
+    uint64 EstimateBGMDSPClockAt(int32 TimelinePositionMs) const;
+
+    /**
+     * @brief ボイスを割り当ててSEを再生
+     * @param AttenuationOverride nullptr 以外ならプリセットの代わりにこの距離減衰を使う
+     * @return 未読み込みで読み込み待ちに積んだ場合は Pending（失敗とは区別する）
+     */
+    ESoundPlayResult PlayVoice(
+        ESoundKinds SoundType,
+        FName SoundName,
+        bool isLoop,
+        bool SetVolume,
+        float Volume,
+        bool IsSpecifyLocation,
+        const FVector& place,
+        const FSoundAttenuationSettings* AttenuationOverride,
+        float PitchOverride = 0.0f,
+        float StartOffset = 0.0f);
+
+    // ==========================
+    // ==== 仮想化 ==============
+    // ==========================
+
+    /** @brief 位置再生で聞こえる距離（距離減衰の最大範囲） */
+    float GetAudibleRadius(const FSoundData& SoundData, const FSoundVoiceSettings& Settings, const FSoundAttenuationSettings* AttenuationOverride) const;
+
+    /**
+     * @brief リスナーから聞こえる範囲か
+     * @param Margin 半径に掛ける倍率（復帰と仮想化の判定が行き来しないように差をつける）
+     */
+    bool IsWithinAudibleRange(const FVector& Location, float AudibleRadius, float Margin = 1.0f) const;
+
+    /**
+     * @brief サウンドを仮想化（鳴らさずにタイミングだけを追う）
+     * @param ElapsedTime 既に鳴っていた時間
+     * @return 仮想化した場合 true（短い音や上限に達した場合は破棄）
+     */
+    bool VirtualizeSound(const FSoundPlayRequest& Request, const USoundBase* Sound, float AudibleRadius, int32 Priority, float ElapsedTime);
+
+    /** @brief 仮想化したサウンドの期限切れ・復帰と、範囲外に出たループ音の仮想化を一定間隔で行う */
+    UE5Coro::TCoroutine<> UpdateVirtualSounds();
+
+    /** @brief 仮想化中のサウンドか、位置指定で再生中のループ音があるか */
+    bool HasVirtualizationWork() const;
+
+    // ==========================
+    // ==== 巻き戻し ============
+    // ==========================
+
+    /** @brief 再生したSEを記録（リングバッファに上書き） */
+    void RecordSoundEvent(ESoundKinds SoundType, FName SoundName, float Volume, bool IsSpecifyLocation, const FVector& place);
+
+    /**
+     * @brief 巻き戻しの開始・終了
+     * @param bRewinding 巻き戻し中か
+     * @param PlaybackRate 1秒あたりに戻る記録時間（秒）
+     */
+    void OnRewindPlaybackChanged(bool bRewinding, float PlaybackRate);
+
+    /** @brief 巻き戻した時刻に合わせて記録したSEの逆再生版を鳴らす */
+    UE5Coro::TCoroutine<> ReverseSoundEventsLoop();
+
+    /** @brief 記録したSEごとに逆再生版を鳴らし始める時刻を求め、新しい順に並べる */
+    void BuildRewindSoundTriggers();
+
+    /** @brief 逆再生版のピッチ（巻き戻しの速さをエンジンのピッチ範囲に収めたもの） */
+    float GetRewindSoundPitch() const;
+
+    // ==========================
+    // ==== 時間倍率 ============
+    // ==========================
+
+    /**
+     * @brief 時間倍率の変更を全ボイスとBGMにまとめて反映
+     * @param TimeDilation ワールドの時間倍率
+     */
+    void OnTimeDilationChanged(float TimeDilation);
+
+    /** @brief 時間倍率に対応するSEのピッチ */
+    float GetTimeDilationPitch() const;
+
+    // ==========================
+    // ==== 距離減衰 ============
+    // ==========================
+
+    /** @brief カテゴリの距離減衰プリセットを生成 */
+    void CreateAttenuationPresets(FSoundData& SoundData);
+
+    /** @brief プリセット名から距離減衰を取得（見つからなければ既定の距離減衰） */
+    USoundAttenuation* FindAttenuation(const FSoundData& SoundData, FName PresetName) const;
+
+    // ==========================
+    // ==== 読み込み ============
+    // ==========================
+
+    /** @brief サウンドを非同期で読み込む（読み込み中・読み込み済みなら何もしない） */
+    void RequestSoundLoad(ESoundKinds SoundType, FName SoundName);
+
+    /** @brief 非同期読み込み完了時の処理 */
+    void OnSoundLoaded(ESoundKinds SoundType, FName SoundName);
+
+    /**
+     * @brief 予算を超えている間、長く使われていないサウンドを解放
+     * @details 再生中・読み込み待ちの再生がある・仮想化中・読み込み直後のサウンドは解放しない
+     */
+    void EnforceMemoryBudget();
+
+    /** @brief サウンドを解放（使っていないボイスからも外す） */
+    void ReleaseSound(FSoundData& SoundData, FName SoundName);
+
+    /**
+     * @brief 読み込み待ちに積む（同じサウンドは最初のリクエストだけ）
+     * @return 読み込み待ちにある場合 true（満杯で積めなければ false）
+     */
+    bool QueuePendingPlay(const FSoundPlayRequest& Request);
+
+    /** @brief 読み込みが終わったサウンドの待ちリクエストを再生 */
+    void FlushPendingPlays(ESoundKinds SoundType, FName SoundName);
+
+    // ==========================
+    // ==== ボイスプール ========
+    // ==========================
+
+    /** @brief カテゴリのボイス（AudioComponent）を事前に確保 */
+    void CreateVoices(FSoundData& SoundData);
+
+    /**
+     * @brief 再生に使うボイスを割り当てる
+     * @details 同時発音数を超えていれば同じサウンドの一番古いボイス、
+     *          空きがあれば空きボイス、なければ優先度が同じか低いボイスを奪う
+     * @return 割り当てられない場合 nullptr
+     */
+    FSoundVoice* AcquireVoice(FSoundData& SoundData, FName SoundName, const FSoundVoiceSettings& Settings);
+
+    /**
+     * @brief 奪うボイスを選ぶ
+     * @param SoundName None 以外ならこのサウンドのボイスだけを対象にする
+     * @param MaxPriority この優先度以下のボイスだけを対象にする
+     */
+    static FSoundVoice* SelectVoiceToSteal(TArray<FSoundVoice>& Voices, ESoundVoiceStealMode StealMode, FName SoundName, int32 MaxPriority);
+
+    static bool IsVoiceActive(const FSoundVoice& Voice);
+
+    /** @brief ボイスの再生終了時にループ指定なら鳴らし直し、ボイス数の統計を更新 */
+    void OnVoiceFinished(UAudioComponent* AudioComponent);
+
+    /** @brief 再生中のボイス数を統計に反映 */
+    void UpdateVoiceStats() const;
+
 private:
     // ==========================
     // ==== サウンドデータ ======
@@ -127,8 +588,103 @@ private:
     UPROPERTY(EditAnywhere, Category = "Sound")
     TMap<ESoundKinds, FSoundData> SoundDataMap;
 
-    UPROPERTY()
-    TMap<FName, UAudioComponent*> LoopSEMap;
+    /** @brief 次に再生するボイスの順番 */
+    uint64 NextVoicePlayOrder = 0;
+
+    /** @brief 奪ったボイスの累計 */
+    int32 StolenVoiceCount = 0;
+
+    /** @brief サウンド読み込みの優先度 */
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    int32 SoundLoadPriority = FStreamableManager::DefaultAsyncLoadPriority;
+
+    /**
+     * @brief レベルごとに事前に読み込むサウンド
+     * Key: レベル名, Value: サウンド名の一覧
+     * 登録のないレベルでは全サウンドを事前に読み込む
+     */
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    TMap<FName, FSoundPreloadList> LevelPreloadMap;
+
+    /** @brief 読み込んだサウンドのメモリ予算（MB、0以下で無制限） */
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    float AudioMemoryBudgetMB = 64.0f;
+
+    /** @brief 読み込み後、予算を超えていても解放しない時間（秒）。読み込んだ直後に解放して読み直すのを防ぐ */
+    UPROPERTY(EditAnywhere, Category = "Sound", meta = (ClampMin = "0.0"))
+    float MinResidencySeconds = 2.0f;
+
+    /** @brief 読み込み待ちのリクエストを破棄するまでの時間（秒） */
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    float PendingPlayTimeout = 0.3f;
+
+    /** @brief 時間倍率によるピッチの下限（エンジンのピッチ下限も考慮する） */
+    UPROPERTY(EditAnywhere, Category = "Sound", meta = (ClampMin = "0.1", ClampMax = "1.0"))
+    float MinTimeDilationPitch = 0.5f;
+
+    /** @brief BGMに時間倍率を伝える FMOD グローバルパラメータ名 */
+    UPROPERTY(EditAnywhere, Category = "FMOD")
+    FName BGMTimeScaleParameter = TEXT("TimeScale");
+
+    /** @brief 現在のワールドの時間倍率 */
+    float CurrentTimeDilation = 1.0f;
+
+    /** @brief 巻き戻し用に記録するSEの件数 */
+    UPROPERTY(EditAnywhere, Category = "Sound", meta = (ClampMin = "0"))
+    int32 SoundEventLogCapacity = 256;
+
+    /** @brief 再生したSEの記録（リングバッファ、Init時に確保） */
+    TArray<FSoundEventRecord> SoundEventLog;
+    int32 SoundEventLogWriteIndex = 0;
+    int32 SoundEventLogCount = 0;
+
+    /** @brief 巻き戻し中か（巻き戻し中の再生は記録しない） */
+    bool bRewindPlaybackActive = false;
+
+    /** @brief 巻き戻しの速さ（1秒あたりに戻る記録時間） */
+    float RewindPlaybackRate = 1.0f;
+
+    /** @brief 逆再生版を鳴らし始める時刻（新しい順、巻き戻し開始時と速さが変わったときに作り直す） */
+    TArray<FRewindSoundTrigger> RewindSoundTriggers;
+
+    /** @brief 次に確認するトリガー（巻き戻しが進むにつれて古い方へ進む） */
+    int32 RewindSoundTriggerCursor = 0;
+
+    /** @brief 仮想化して追跡するサウンドの上限 */
+    UPROPERTY(EditAnywhere, Category = "Sound", meta = (ClampMin = "0"))
+    int32 MaxVirtualSounds = 32;
+
+    /** @brief これより短いワンショットは仮想化せずに破棄（秒） */
+    UPROPERTY(EditAnywhere, Category = "Sound", meta = (ClampMin = "0.0"))
+    float MinVirtualDuration = 0.5f;
+
+    /** @brief 仮想化の更新間隔（秒、実時間） */
+    UPROPERTY(EditAnywhere, Category = "Sound", meta = (ClampMin = "0.0"))
+    float VirtualUpdateInterval = 0.25f;
+
+    /** @brief 再生中のループ音を仮想化する距離の倍率（聞こえる距離に対して） */
+    UPROPERTY(EditAnywhere, Category = "Sound", meta = (ClampMin = "1.0"))
+    float VirtualizeDistanceMargin = 1.1f;
+
+    /** @brief 仮想化中のサウンド */
+    TArray<FVirtualSound> VirtualSounds;
+
+    /** @brief 仮想化の更新ループが動いているか */
+    bool bVirtualLoopRunning = false;
+
+    /** @brief 読み込み待ちの再生リクエスト（数件だけ保持） */
+    TArray<FSoundPlayRequest> PendingPlays;
+
+    /** @brief 次に再生するサウンドの順番（LRU用） */
+    uint64 NextSoundUseOrder = 0;
+
+    /** @brief プリセット指定のない位置再生に使う距離減衰 */
+    UPROPERTY(EditAnywhere, Category = "Sound")
+    FSoundAttenuationSettings DefaultAttenuationSettings;
+
+    /** @brief Init時に生成した既定の距離減衰 */
+    UPROPERTY(Transient)
+    USoundAttenuation* DefaultAttenuation;
 
     // ==========================
     // ==== BGM関連コンポーネント ====
@@ -149,6 +705,12 @@ private:
     /** @brief FMOD EventInstance */
     FMOD::Studio::EventInstance* EventInstance;
 
+    /** @brief 次のビート番号（BGMのインスタンスを作り直すたびに0に戻す） */
+    int32 NextBGMBeatIndex = 0;
+
+    /** @brief FMODの出力サンプルレート（DSP クロックの換算用） */
+    int32 BGMSampleRate = 0;
+
     /** @brief FMOD AudioComponent参照 */
     UPROPERTY()
     UFMODAudioComponent* FMODAudioComponent;
@@ -25,8 +25,9 @@ void UTimeManagerSubsystem::Deinitialize()
 }
 
 // 処理の流れ:
-// 1. Playerならプレイヤーコンポーネントに設定
-// 2. それ以外ならワールドコンポーネントに追加
+// 1. 巻き戻しの開始・終了を購読
+// 2. Playerならプレイヤーコンポーネントに設定
+// 3. それ以外ならワールドコンポーネントに追加
 void UTimeManagerSubsystem::RegisterTimeComponent(UTimeManipulatorComponent* Component, bool bIsPlayer)
 {
     if (!Component)
@@ -34,6 +35,12 @@ void UTimeManagerSubsystem::RegisterTimeComponent(UTimeManipulatorComponent* Com
         return;
     }
 
+    const TWeakObjectPtr<UTimeManipulatorComponent> WeakComponent(Component);
+    Component->OnRewindStarted.RemoveAll(this);
+    Component->OnRewindStopped.RemoveAll(this);
+    Component->OnRewindStarted.AddUObject(this, &UTimeManagerSubsystem::OnComponentRewindStarted, WeakComponent);
+    Component->OnRewindStopped.AddUObject(this, &UTimeManagerSubsystem::OnComponentRewindStopped, WeakComponent);
+
     if (bIsPlayer)
     {
         PlayerComponent = Component;
@@ -48,7 +55,8 @@ void UTimeManagerSubsystem::RegisterTimeComponent(UTimeManipulatorComponent* Com
 }
 
 // 処理の流れ:
-// 1. 該当コンポーネントを削除
+// 1. 購読を解除し、巻き戻し中なら終了扱いにする
+// 2. 該当コンポーネントを削除
 void UTimeManagerSubsystem::UnregisterTimeComponent(UTimeManipulatorComponent* Component)
 {
     if (!Component)
@@ -56,6 +64,10 @@ void UTimeManagerSubsystem::UnregisterTimeComponent(UTimeManipulatorComponent* C
         return;
     }
 
+    Component->OnRewindStarted.RemoveAll(this);
+    Component->OnRewindStopped.RemoveAll(this);
+    OnComponentRewindStopped(Component);
+
     if (PlayerComponent == Component)
     {
         PlayerComponent.Reset();
@@ -138,8 +150,41 @@ void UTimeManagerSubsystem::SetRewindQuality(ERewindQuality Quality)
         static_cast<int32>(Quality));
 }
 
+// 処理の流れ:
+// 1. 巻き戻し中のコンポーネントに追加
+// 2. 最初の1つなら巻き戻し開始を通知
+void UTimeManagerSubsystem::OnComponentRewindStarted(TWeakObjectPtr<UTimeManipulatorComponent> Component)
+{
+    if (!Component.IsValid())
+    {
+        return;
+    }
+
+    RewindingComponents.AddUnique(Component);
+    if (RewindingComponents.Num() == 1)
+    {
+        OnRewindPlaybackChanged.Broadcast(true, Component->GetRewindPlaybackRate());
+    }
+}
+
+// 処理の流れ:
+// 1. 巻き戻し中のコンポーネントから削除（無効なものも削除）
+// 2. 全て終わったら巻き戻し終了を通知
+void UTimeManagerSubsystem::OnComponentRewindStopped(TWeakObjectPtr<UTimeManipulatorComponent> Component)
+{
+    const int32 Removed = RewindingComponents.RemoveAll([&Component](const TWeakObjectPtr<UTimeManipulatorComponent>& Comp) {
+        return Comp == Component || !Comp.IsValid();
+        });
+
+    if (Removed > 0 && RewindingComponents.Num() == 0)
+    {
+        OnRewindPlaybackChanged.Broadcast(false, 0.0f);
+    }
+}
+
 // 処理の流れ:
 // 1. 全コンポーネントにTimeDilationを設定
+// 2. 倍率が変わっていれば通知
 void UTimeManagerSubsystem::SetCustomTimeDilationWorld(float Scale)
 {
     int32 ComponentsAffected = 0;
@@ -158,4 +203,10 @@ void UTimeManagerSubsystem::SetCustomTimeDilationWorld(float Scale)
 
     UE_LOG(LogTemp, Log, TEXT("TimeManager: Set dilation %.2f for %d components"),
         Scale, ComponentsAffected);
+
+    if (!FMath::IsNearlyEqual(CurrentTimeDilation, Scale))
+    {
+        CurrentTimeDilation = Scale;
+        OnTimeDilationChanged.Broadcast(Scale);
+    }
 }
\ No newline at end of file
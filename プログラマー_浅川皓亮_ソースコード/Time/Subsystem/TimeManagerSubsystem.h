@@ -11,6 +11,8 @@ enum class ERewindQuality : uint8;
 class IUIManagerProvider;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSlowStopped);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnTimeDilationChanged, float);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnRewindPlaybackChanged, bool /*bRewinding*/, float /*PlaybackRate*/);
 
 /**
  * @brief ワールド全体の時間操作管理（最適化版）
@@ -49,8 +51,20 @@ public:
     /** @brief スローモーション終了処理 */
     void ResetTimeDilation();
 
+    /** @brief 現在のワールドの時間倍率 */
+    float GetTimeDilation() const { return CurrentTimeDilation; }
+
     static FOnSlowStopped OnSlowStopped;
 
+    /** @brief ワールドの時間倍率が変わったとき（変わるたびに1回） */
+    FOnTimeDilationChanged OnTimeDilationChanged;
+
+    /** @brief いずれかのコンポーネントが巻き戻しを始めた・全て終わったとき */
+    FOnRewindPlaybackChanged OnRewindPlaybackChanged;
+
+    /** @brief 巻き戻し中のコンポーネントがあるか */
+    bool IsAnyRewinding() const { return RewindingComponents.Num() > 0; }
+
 private:
     // ============================================
     // Internal Logic
@@ -58,6 +72,10 @@ private:
     /** @brief 全コンポーネントにTimeDilationを設定 */
     void SetCustomTimeDilationWorld(float Scale);
 
+    /** @brief コンポーネントの巻き戻し開始・終了を集計 */
+    void OnComponentRewindStarted(TWeakObjectPtr<UTimeManipulatorComponent> Component);
+    void OnComponentRewindStopped(TWeakObjectPtr<UTimeManipulatorComponent> Component);
+
 private:
     // ============================================
     // Component Management
@@ -69,6 +87,9 @@ private:
     UPROPERTY()
     TArray<TWeakObjectPtr<UTimeManipulatorComponent>> WorldComponents;
 
+    /** @brief 巻き戻し中のコンポーネント */
+    TArray<TWeakObjectPtr<UTimeManipulatorComponent>> RewindingComponents;
+
 private:
     // ============================================
     // Settings
@@ -78,4 +99,6 @@ private:
     float SlowMotionDuration = 10.0f;
 
     FTimerHandle SlowMotionTimerHandle;
+
+    float CurrentTimeDilation = 1.0f;
 };
\ No newline at end of file
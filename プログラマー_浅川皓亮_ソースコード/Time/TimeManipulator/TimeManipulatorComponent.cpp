@@ -4,6 +4,7 @@
 #include "Component/TimeManipulatorComponent.h"
 #include "Component/PlayerCameraControlComponent.h"  
 #include "Camera/CameraComponent.h"         
+#include "Camera/LayeredCameraManager.h"
 
 #include "GameFramework/Actor.h"
 #include "GameFramework/Character.h"
@@ -160,6 +161,7 @@ void UTimeManipulatorComponent::StartRewind()
 // 1. 停止フラグを立てる
 // 2. バッファをクリア
 // 3. 移動状態を復元
+// 4. カメラの巻き戻しレイヤーを解除し、最後の回転をControlRotationへ反映
 void UTimeManipulatorComponent::StopRewind()
 {
     if (!bIsRewinding)
@@ -172,6 +174,20 @@ void UTimeManipulatorComponent::StopRewind()
     SnapshotWriteIndex = 0;
     SnapshotBuffer.Reset();
     RestoreMovementState();
+
+    if (ALayeredCameraManager* CameraManager = ALayeredCameraManager::FindForActor(CachedOwner.Get()))
+    {
+        CameraManager->ClearLayer(ECameraLayer::Rewind);
+    }
+
+    if (bHasRewoundControlRotation)
+    {
+        if (APlayerController* PC = Cast<APlayerController>(CachedOwner->GetInstigatorController()))
+        {
+            PC->SetControlRotation(RewoundControlRotation);
+        }
+        bHasRewoundControlRotation = false;
+    }
     OnRewindStopped.Broadcast();
 
     if (RecordingMode == ERecordingMode::Automatic)
@@ -373,7 +389,7 @@ void UTimeManipulatorComponent::CaptureSnapshot()
             Snapshot.bHasCameraData = true;
             Snapshot.CameraRotation = Camera->GetComponentRotation();
             Snapshot.CameraRoll = CachedCameraControl->GetCurrentRoll();
-            Snapshot.CameraFOV = Camera->FieldOfView;
+            Snapshot.CameraFOV = CachedCameraControl->GetCurrentFOV();
         }
     }
     SnapshotBuffer[SnapshotWriteIndex] = Snapshot;
@@ -383,6 +399,7 @@ void UTimeManipulatorComponent::CaptureSnapshot()
 // 処理の流れ:
 // 1. 2つのスナップショット間を補間
 // 2. アクターに適用
+// 3. カメラは巻き戻しレイヤー（Override）で表示し、ControlRotationは終了時にまとめて反映
 void UTimeManipulatorComponent::ApplySnapshotLerped(int32 FromIndex, int32 ToIndex, float Alpha)
 {
     if (!CachedOwner.IsValid() ||
@@ -419,11 +436,23 @@ void UTimeManipulatorComponent::ApplySnapshotLerped(int32 FromIndex, int32 ToInd
         const float CameraRoll = FMath::Lerp(From.CameraRoll, To.CameraRoll, Alpha);
         const float CameraFOV = FMath::Lerp(From.CameraFOV, To.CameraFOV, Alpha);
 
-        if (APlayerController* PC = Cast<APlayerController>(CachedOwner->GetInstigatorController()))
+        if (ALayeredCameraManager* CameraManager = ALayeredCameraManager::FindForActor(CachedOwner.Get()))
         {
+            FCameraLayerValue RewindLayer;
+            RewindLayer.Blend = ECameraLayerBlend::Override;
+            RewindLayer.Rotation = FRotator(CameraRot.Pitch, CameraRot.Yaw, CameraRoll);
+            RewindLayer.FOV = CameraFOV;
+            CameraManager->SetLayer(ECameraLayer::Rewind, RewindLayer);
+        }
+        else if (APlayerController* PC = Cast<APlayerController>(CachedOwner->GetInstigatorController()))
+        {
+            // レイヤー式のカメラマネージャーがなければ従来どおり直接回す
             PC->SetControlRotation(CameraRot);
         }
 
+        RewoundControlRotation = CameraRot;
+        bHasRewoundControlRotation = true;
+
         CachedCameraControl->SetCameraRoll(CameraRoll);
         CachedCameraControl->SetFOV(CameraFOV, true);
     }
@@ -119,6 +119,9 @@ public:
     UFUNCTION(BlueprintPure, Category = "Time Manipulation")
     int32 GetSnapshotCount() const { return bBufferFull ? MaxSnapshots : SnapshotWriteIndex;}
 
+    /** @brief 巻き戻し中、1秒あたりに戻る記録時間（秒） */
+    float GetRewindPlaybackRate() const { return SnapshotInterval * RewindTargetFPS; }
+
     // ============================================
     // Delegates
     // ============================================
@@ -213,6 +216,10 @@ private:
     UPROPERTY(EditAnywhere)
     bool bIsSetSubsystem = true;
 
+    /** @brief 巻き戻し中に表示したカメラ回転（終了時に一度だけControlRotationへ反映） */
+    FRotator RewoundControlRotation = FRotator::ZeroRotator;
+    bool bHasRewoundControlRotation = false;
+
     /** @brief 保存された移動状態 */
     TEnumAsByte<EMovementMode> SavedMovementMode = MOVE_Walking;
     uint8 SavedCustomMovementMode = 0;
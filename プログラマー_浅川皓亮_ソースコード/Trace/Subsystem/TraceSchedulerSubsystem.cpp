@@ -0,0 +1,208 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SubSystem/TraceSchedulerSubsystem.h"
+#include "Engine/World.h"
+
+void UTraceSchedulerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    UE_LOG(LogTemp, Log, TEXT("TraceScheduler: Initialized (Budget=%d)"), TraceBudgetPerFrame);
+}
+
+void UTraceSchedulerSubsystem::Deinitialize()
+{
+    for (TArray<FTraceRequest>& Queue : Queues)
+    {
+        Queue.Empty();
+    }
+
+    Super::Deinitialize();
+}
+
+TStatId UTraceSchedulerSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UTraceSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+// 処理の流れ:
+// 1. Urgent は即時実行してコールバック
+// 2. それ以外は優先度ごとのキューへ
+void UTraceSchedulerSubsystem::Submit(FTraceRequest&& Request)
+{
+    if (Request.Priority == ETracePriority::Urgent)
+    {
+        FHitResult Hit;
+        const bool bHit = RunTrace(Request, Hit);
+        Request.OnCompleted.ExecuteIfBound(bHit, Hit);
+        return;
+    }
+
+    Request.SubmitFrame = GFrameCounter;
+    Queues[static_cast<int32>(Request.Priority)].Add(MoveTemp(Request));
+}
+
+bool UTraceSchedulerSubsystem::ExecuteImmediate(const FTraceRequest& Request, FHitResult& OutHit)
+{
+    return RunTrace(Request, OutHit);
+}
+
+// 処理の流れ:
+// 1. Urgent か予算が残っていれば実行
+// 2. 予算切れなら実行しない
+bool UTraceSchedulerSubsystem::TryExecuteImmediate(const FTraceRequest& Request, FHitResult& OutHit, bool& bOutHit)
+{
+    if (Request.Priority != ETracePriority::Urgent && !HasBudget())
+    {
+        return false;
+    }
+
+    bOutHit = RunTrace(Request, OutHit);
+    return true;
+}
+
+// 処理の流れ:
+// 1. Urgent か予算が残っていればカウントして許可
+bool UTraceSchedulerSubsystem::TryConsumeBudget(ETracePriority Priority)
+{
+    if (Priority != ETracePriority::Urgent && !HasBudget())
+    {
+        return false;
+    }
+
+    ++FrameTraceCount;
+    return true;
+}
+
+// 処理の流れ:
+// 1. Tick中なら印を付けるだけにする（処理中のインデックスがずれないように）
+// 2. それ以外はその場で取り除く
+void UTraceSchedulerSubsystem::CancelRequests(const UObject* Requester)
+{
+    for (TArray<FTraceRequest>& Queue : Queues)
+    {
+        for (FTraceRequest& Request : Queue)
+        {
+            if (Request.Requester.Get() == Requester)
+            {
+                Request.bCancelled = true;
+                bHasDeferredCancels = true;
+            }
+        }
+    }
+
+    if (!bIsProcessingQueues)
+    {
+        RemoveCancelledRequests();
+    }
+}
+
+void UTraceSchedulerSubsystem::RemoveCancelledRequests()
+{
+    if (!bHasDeferredCancels)
+    {
+        return;
+    }
+
+    for (TArray<FTraceRequest>& Queue : Queues)
+    {
+        Queue.RemoveAll([](const FTraceRequest& Request) {
+            return Request.bCancelled;
+            });
+    }
+    bHasDeferredCancels = false;
+}
+
+int32 UTraceSchedulerSubsystem::GetPendingCount() const
+{
+    int32 Count = 0;
+    for (const TArray<FTraceRequest>& Queue : Queues)
+    {
+        Count += Queue.Num();
+    }
+    return Count;
+}
+
+// 処理の流れ:
+// 1. 優先度の高いキューから順に、予算内で実行してコールバック
+// 2. 予算切れでも、待たされすぎた要求は実行
+// 3. 実行済みの要求をキューから取り除く
+// 4. コールバック中にキャンセルされた要求を取り除く
+// 5. フレームのカウンタをリセット
+void UTraceSchedulerSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    const uint64 CurrentFrame = GFrameCounter;
+    bIsProcessingQueues = true;
+
+    for (TArray<FTraceRequest>& Queue : Queues)
+    {
+        // コールバック内での Submit に備え、開始時点の要求数までを処理する
+        const int32 NumAtStart = Queue.Num();
+        int32 ProcessedCount = 0;
+
+        for (; ProcessedCount < NumAtStart; ++ProcessedCount)
+        {
+            // キャンセル済みは予算を使わずに読み飛ばす
+            if (Queue[ProcessedCount].bCancelled)
+            {
+                continue;
+            }
+
+            const bool bOverdue = CurrentFrame - Queue[ProcessedCount].SubmitFrame >= static_cast<uint64>(MaxDeferFrames);
+            if (!HasBudget() && !bOverdue)
+            {
+                break;
+            }
+
+            FTraceRequest Request = MoveTemp(Queue[ProcessedCount]);
+
+            // 要求元が破棄されていればスキップ
+            if (!Request.Requester.IsValid() && !Request.Requester.IsExplicitlyNull())
+            {
+                continue;
+            }
+
+            FHitResult Hit;
+            const bool bHit = RunTrace(Request, Hit);
+            Request.OnCompleted.ExecuteIfBound(bHit, Hit);
+        }
+
+        if (ProcessedCount > 0)
+        {
+            Queue.RemoveAt(0, ProcessedCount, EAllowShrinking::No);
+        }
+    }
+
+    bIsProcessingQueues = false;
+    RemoveCancelledRequests();
+
+    LastFrameTraceCount = FrameTraceCount;
+    FrameTraceCount = 0;
+}
+
+// 処理の流れ:
+// 1. ライン形状ならライントレース、それ以外はSweep
+// 2. チャンネル指定 or オブジェクトタイプ指定
+bool UTraceSchedulerSubsystem::RunTrace(const FTraceRequest& Request, FHitResult& OutHit)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return false;
+    }
+
+    ++FrameTraceCount;
+
+    if (Request.Shape.IsLine())
+    {
+        return Request.bByObjectType
+            ? World->LineTraceSingleByObjectType(OutHit, Request.Start, Request.End, Request.ObjectQueryParams, Request.Params)
+            : World->LineTraceSingleByChannel(OutHit, Request.Start, Request.End, Request.Channel, Request.Params);
+    }
+
+    return Request.bByObjectType
+        ? World->SweepSingleByObjectType(OutHit, Request.Start, Request.End, Request.Rotation, Request.ObjectQueryParams, Request.Shape, Request.Params)
+        : World->SweepSingleByChannel(OutHit, Request.Start, Request.End, Request.Rotation, Request.Channel, Request.Shape, Request.Params);
+}
@@ -0,0 +1,177 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CollisionQueryParams.h"
+#include "CollisionShape.h"
+#include "TraceSchedulerSubsystem.generated.h"
+
+/**
+ * @brief トレース要求の優先度
+ */
+UENUM(BlueprintType)
+enum class ETracePriority : uint8
+{
+    Urgent  UMETA(DisplayName = "Urgent"),   // プレイヤーなど。予算に関係なく即時実行
+    High    UMETA(DisplayName = "High"),
+    Normal  UMETA(DisplayName = "Normal"),
+    Low     UMETA(DisplayName = "Low"),
+};
+
+/**
+ * @brief トレース完了通知
+ * @param bool ブロッキングヒットしたか
+ * @param FHitResult& ヒット情報
+ */
+DECLARE_DELEGATE_TwoParams(FOnTraceCompleted, bool, const FHitResult&);
+
+/**
+ * @brief トレース要求
+ * @details Shape がライン（デフォルト）ならライントレース、それ以外はSweep
+ */
+struct FTraceRequest
+{
+    FVector Start = FVector::ZeroVector;
+    FVector End = FVector::ZeroVector;
+    FQuat Rotation = FQuat::Identity;
+    FCollisionShape Shape;
+
+    /** bByObjectType が false のときに使うチャンネル */
+    ECollisionChannel Channel = ECC_Visibility;
+
+    /** true なら ObjectQueryParams でオブジェクトタイプ指定のトレース */
+    bool bByObjectType = false;
+    FCollisionObjectQueryParams ObjectQueryParams;
+
+    FCollisionQueryParams Params;
+
+    ETracePriority Priority = ETracePriority::Normal;
+
+    /** 要求元（キャンセル用） */
+    TWeakObjectPtr<const UObject> Requester;
+
+    /** 完了通知（遅延実行時のみ使用） */
+    FOnTraceCompleted OnCompleted;
+
+    /** 要求されたフレーム番号（内部用） */
+    uint64 SubmitFrame = 0;
+
+    /** Tick中にキャンセルされた（内部用。Tick後にまとめて取り除く） */
+    bool bCancelled = false;
+};
+
+/**
+ * @brief ワールド共通のトレーススケジューラ
+ *
+ * 各検出コンポーネントのトレースを1か所に集め、1フレームあたりの
+ * トレース数を TraceBudgetPerFrame に抑える。
+ *
+ * - Urgent はその場で実行（予算を消費するが待たせない）
+ * - それ以外はキューに積み、優先度順にTickで予算内だけ実行して
+ *   コールバックで返す。MaxDeferFrames 以上待った要求は予算を無視して実行
+ * - 毎ステップ判定が必要な処理向けに、予算が残っているときだけ実行する
+ *   TryExecuteImmediate も提供（実行されなければ前回の結果を使う想定）
+ *
+ * 設定は DefaultGame.ini の [/Script/Carry.TraceSchedulerSubsystem] で変更する。
+ */
+UCLASS(Config = Game)
+class CARRY_API UTraceSchedulerSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ============================================
+    // Public API
+    // ============================================
+
+    /**
+     * @brief 要求をキューに積む（Urgent は即時実行してコールバック）
+     */
+    void Submit(FTraceRequest&& Request);
+
+    /**
+     * @brief 予算に関係なく即時実行
+     * @return ブロッキングヒットしたか
+     */
+    bool ExecuteImmediate(const FTraceRequest& Request, FHitResult& OutHit);
+
+    /**
+     * @brief 今フレームの予算が残っていれば即時実行
+     * @param bOutHit 実行した場合のヒット有無
+     * @return 実行したか（false なら予算切れ）
+     */
+    bool TryExecuteImmediate(const FTraceRequest& Request, FHitResult& OutHit, bool& bOutHit);
+
+    /**
+     * @brief 呼び出し側で直接実行するトレース分の予算を確保
+     * @details マルチヒットのSweepなど、要求形式に載らないクエリ用
+     * @return 実行してよいか（Urgent は常に true）
+     */
+    bool TryConsumeBudget(ETracePriority Priority);
+
+    /**
+     * @brief 要求元の待機中リクエストを破棄
+     * @details Tick中（コールバック内）に呼ばれた場合は印を付けるだけにし、Tickの最後に取り除く
+     */
+    void CancelRequests(const UObject* Requester);
+
+    /** @brief 前フレームの実行トレース数（プロファイル用） */
+    int32 GetLastFrameTraceCount() const { return LastFrameTraceCount; }
+
+    /** @brief 待機中のリクエスト数 */
+    int32 GetPendingCount() const;
+
+private:
+    // ============================================
+    // Internal Logic
+    // ============================================
+
+    /** @brief トレースを実行してカウント */
+    bool RunTrace(const FTraceRequest& Request, FHitResult& OutHit);
+
+    /** @brief 今フレームの予算が残っているか */
+    bool HasBudget() const { return FrameTraceCount < TraceBudgetPerFrame; }
+
+    /** @brief キャンセルの印が付いた要求を取り除く */
+    void RemoveCancelledRequests();
+
+private:
+    // ============================================
+    // Queues
+    // ============================================
+
+    /** 優先度ごとのFIFO（Urgent 以外） */
+    TArray<FTraceRequest> Queues[static_cast<int32>(ETracePriority::Low) + 1];
+
+    /** 今フレームの実行数 */
+    int32 FrameTraceCount = 0;
+
+    /** 前フレームの実行数 */
+    int32 LastFrameTraceCount = 0;
+
+    /** キューを処理中か（この間はキューの要素を削除しない） */
+    bool bIsProcessingQueues = false;
+
+    /** Tick中にキャンセルされた要求があるか */
+    bool bHasDeferredCancels = false;
+
+private:
+    // ============================================
+    // Settings
+    // ============================================
+
+    /** 1フレームあたりのトレース予算 */
+    UPROPERTY(Config)
+    int32 TraceBudgetPerFrame = 64;
+
+    /** この回数以上待たされた要求は予算を無視して実行 */
+    UPROPERTY(Config)
+    int32 MaxDeferFrames = 6;
+};
@@ -0,0 +1,41 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "TraversalPhysicalMaterial.generated.h"
+
+/**
+ * @brief 移動アクションに関する面の性質
+ */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class ETraversalFlags : uint8
+{
+    None      = 0       UMETA(Hidden),
+    NoWallRun = 1 << 0  UMETA(DisplayName = "No Wall Run"),  // 壁走り不可
+    NoParkour = 1 << 1  UMETA(DisplayName = "No Parkour"),   // 登る・乗り越える不可
+    Slippery  = 1 << 2  UMETA(DisplayName = "Slippery"),     // 滑る（静止・スリープしない）
+};
+ENUM_CLASS_FLAGS(ETraversalFlags);
+
+/**
+ * @brief 移動アクションの可否を持つ物理マテリアル
+ *
+ * 面のルールをタグ文字列ではなくマテリアルで指定する。
+ * 値は UTraversalSurfaceSubsystem がコンポーネント単位で解決してキャッシュする。
+ */
+UCLASS()
+class CARRY_API UTraversalPhysicalMaterial : public UPhysicalMaterial
+{
+    GENERATED_BODY()
+
+public:
+    /** @brief 面の性質 */
+    ETraversalFlags GetTraversalFlags() const { return static_cast<ETraversalFlags>(TraversalFlags); }
+
+private:
+    /** 面の性質 */
+    UPROPERTY(EditAnywhere, Category = "Traversal", meta = (Bitmask, BitmaskEnum = "/Script/Carry.ETraversalFlags"))
+    uint8 TraversalFlags = 0;
+};
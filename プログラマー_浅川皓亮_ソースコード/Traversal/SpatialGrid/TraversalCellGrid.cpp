@@ -0,0 +1,66 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Object/Traversal/TraversalCellGrid.h"
+
+#if WITH_EDITOR
+void FTraversalCellGrid::Initialize(const FBox& InBounds, float InCellSize)
+{
+    Bounds = InBounds;
+    CellSize = FMath::Max(InCellSize, 1.0f);
+
+    const FVector Size = Bounds.GetSize();
+    GridSize = FIntPoint(
+        FMath::Max(1, FMath::CeilToInt(Size.X / CellSize)),
+        FMath::Max(1, FMath::CeilToInt(Size.Y / CellSize))
+    );
+}
+
+// 処理の流れ:
+// 1. 各要素のセル範囲が覆うセルを数える
+// 2. 開始位置を累積和で求める
+// 3. 要素インデックスを詰める
+void FTraversalCellGrid::BuildCells(const TArray<TPair<FIntPoint, FIntPoint>>& ElementCells)
+{
+    const int32 CellCount = GridSize.X * GridSize.Y;
+
+    // セルごとの個数
+    TArray<int32> Counts;
+    Counts.SetNumZeroed(CellCount);
+
+    for (const TPair<FIntPoint, FIntPoint>& Range : ElementCells)
+    {
+        for (int32 Y = Range.Key.Y; Y <= Range.Value.Y; ++Y)
+        {
+            for (int32 X = Range.Key.X; X <= Range.Value.X; ++X)
+            {
+                ++Counts[ToCellIndex(FIntPoint(X, Y))];
+            }
+        }
+    }
+
+    // 累積和
+    CellStart.SetNumUninitialized(CellCount + 1);
+    CellStart[0] = 0;
+    for (int32 CellIndex = 0; CellIndex < CellCount; ++CellIndex)
+    {
+        CellStart[CellIndex + 1] = CellStart[CellIndex] + Counts[CellIndex];
+    }
+
+    // 詰める
+    CellItems.SetNumUninitialized(CellStart[CellCount]);
+    TArray<int32> WriteOffsets(CellStart.GetData(), CellCount);
+
+    for (int32 ElementIndex = 0; ElementIndex < ElementCells.Num(); ++ElementIndex)
+    {
+        const TPair<FIntPoint, FIntPoint>& Range = ElementCells[ElementIndex];
+        for (int32 Y = Range.Key.Y; Y <= Range.Value.Y; ++Y)
+        {
+            for (int32 X = Range.Key.X; X <= Range.Value.X; ++X)
+            {
+                CellItems[WriteOffsets[ToCellIndex(FIntPoint(X, Y))]++] = ElementIndex;
+            }
+        }
+    }
+}
+#endif
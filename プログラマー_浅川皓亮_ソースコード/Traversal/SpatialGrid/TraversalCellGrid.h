@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TraversalCellGrid.generated.h"
+
+/**
+ * @brief 焼き込み済みの要素をXY平面の一様グリッドに登録する空間インデックス
+ *
+ * セルごとの要素リストを CellStart / CellItems の連続配列（CSR形式）で持つ。
+ * 要素そのものは持たず、呼び出し側の配列のインデックスだけを保存する。
+ * UWallRunSurfaceIndex（壁面）と UParkourLedgeIndex（縁）で共通に使う。
+ */
+USTRUCT()
+struct CARRY_API FTraversalCellGrid
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief 位置の周囲のセルにある要素を列挙（複数セルにまたがる要素は重複して渡ることがある）
+     * @param Elements 構築時と同じ要素の配列
+     * @param Location 問い合わせ位置
+     * @param Radius 問い合わせ半径
+     * @param Visitor 要素ごとに呼ばれる（インデックス, 要素）
+     */
+    template<typename ElementType, typename VisitorType>
+    void ForEachElementNear(const TArray<ElementType>& Elements, const FVector& Location, float Radius, VisitorType&& Visitor) const
+    {
+        if (GridSize.X <= 0 || GridSize.Y <= 0)
+        {
+            return;
+        }
+
+        const FIntPoint MinCell = ToCell(Location - FVector(Radius));
+        const FIntPoint MaxCell = ToCell(Location + FVector(Radius));
+
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+            {
+                const int32 CellIndex = ToCellIndex(FIntPoint(X, Y));
+
+                for (int32 Item = CellStart[CellIndex]; Item < CellStart[CellIndex + 1]; ++Item)
+                {
+                    const int32 ElementIndex = CellItems[Item];
+                    Visitor(ElementIndex, Elements[ElementIndex]);
+                }
+            }
+        }
+    }
+
+    /** @brief 位置が焼き込み範囲内か */
+    bool ContainsLocation(const FVector& Location) const { return Bounds.IsInsideOrOn(Location); }
+
+    /** @brief セル数（XY） */
+    FIntPoint GetGridSize() const { return GridSize; }
+
+#if WITH_EDITOR
+    /**
+     * @brief 要素ごとの範囲からグリッドを構築（エディタ専用）
+     * @param Elements 登録する要素
+     * @param GetElementBounds 要素 → 要素が占める範囲（FBox）
+     * @param InBounds 焼き込み範囲
+     * @param InCellSize セルの一辺
+     */
+    template<typename ElementType, typename BoundsFuncType>
+    void Build(const TArray<ElementType>& Elements, BoundsFuncType&& GetElementBounds, const FBox& InBounds, float InCellSize)
+    {
+        Initialize(InBounds, InCellSize);
+
+        TArray<TPair<FIntPoint, FIntPoint>> ElementCells;
+        ElementCells.Reserve(Elements.Num());
+
+        for (const ElementType& Element : Elements)
+        {
+            const FBox ElementBounds = GetElementBounds(Element);
+            ElementCells.Emplace(ToCell(ElementBounds.Min), ToCell(ElementBounds.Max));
+        }
+
+        BuildCells(ElementCells);
+    }
+#endif
+
+private:
+    /** @brief XY座標 → セル座標（範囲外はクランプ） */
+    FIntPoint ToCell(const FVector& Location) const
+    {
+        const FVector Local = Location - Bounds.Min;
+        return FIntPoint(
+            FMath::Clamp(FMath::FloorToInt(Local.X / CellSize), 0, GridSize.X - 1),
+            FMath::Clamp(FMath::FloorToInt(Local.Y / CellSize), 0, GridSize.Y - 1)
+        );
+    }
+
+    /** @brief セル座標 → CellStart のインデックス */
+    int32 ToCellIndex(const FIntPoint& Cell) const { return Cell.Y * GridSize.X + Cell.X; }
+
+#if WITH_EDITOR
+    /** @brief 範囲とセルサイズからセル数を決める */
+    void Initialize(const FBox& InBounds, float InCellSize);
+
+    /** @brief 要素ごとのセル範囲から CellStart / CellItems を詰める */
+    void BuildCells(const TArray<TPair<FIntPoint, FIntPoint>>& ElementCells);
+#endif
+
+private:
+    /** セルごとのリストの開始位置（セル数 + 1） */
+    UPROPERTY()
+    TArray<int32> CellStart;
+
+    /** 全セルの要素インデックスを連結した配列 */
+    UPROPERTY()
+    TArray<int32> CellItems;
+
+    /** 焼き込み範囲 */
+    UPROPERTY(VisibleAnywhere, Category = "Grid")
+    FBox Bounds = FBox(ForceInit);
+
+    /** セルの一辺 */
+    UPROPERTY(VisibleAnywhere, Category = "Grid")
+    float CellSize = 400.0f;
+
+    /** セル数（XY） */
+    UPROPERTY(VisibleAnywhere, Category = "Grid")
+    FIntPoint GridSize = FIntPoint::ZeroValue;
+};
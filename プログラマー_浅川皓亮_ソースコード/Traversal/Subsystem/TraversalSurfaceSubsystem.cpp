@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SubSystem/TraversalSurfaceSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+namespace TraversalTags
+{
+    // 既存レベル互換のタグ
+    const FName NoWallRun(TEXT("NoWallRun"));
+    const FName NoParkour(TEXT("NoParkour"));
+    const FName Slippery(TEXT("Slippery"));
+}
+
+void UTraversalSurfaceSubsystem::Deinitialize()
+{
+    ComponentFlags.Empty();
+    Super::Deinitialize();
+}
+
+// 処理の流れ:
+// 1. コンポーネントの性質をキャッシュから取得
+// 2. ヒット位置の物理マテリアルの性質を加える
+ETraversalFlags UTraversalSurfaceSubsystem::GetFlags(const FHitResult& Hit)
+{
+    ETraversalFlags Flags = GetFlags(Hit.GetComponent());
+    Flags |= GetMaterialFlags(Hit.PhysMaterial.Get());
+    return Flags;
+}
+
+// 処理の流れ:
+// 1. IDで検索し、同じコンポーネントならキャッシュを返す
+// 2. 無い・IDが再利用されていた場合は解決して保存
+ETraversalFlags UTraversalSurfaceSubsystem::GetFlags(const UPrimitiveComponent* Component)
+{
+    if (!Component)
+    {
+        return ETraversalFlags::None;
+    }
+
+    FTraversalFlagEntry& Entry = ComponentFlags.FindOrAdd(Component->GetUniqueID());
+    if (Entry.Component.Get() != Component)
+    {
+        Entry.Component = Component;
+        Entry.Flags = ResolveFlags(Component);
+    }
+
+    return Entry.Flags;
+}
+
+void UTraversalSurfaceSubsystem::InvalidateComponent(const UPrimitiveComponent* Component)
+{
+    if (Component)
+    {
+        ComponentFlags.Remove(Component->GetUniqueID());
+    }
+}
+
+// 処理の流れ:
+// 1. ボディの物理マテリアルから性質を取得
+// 2. コンポーネントとアクターのタグを加える（既存レベル互換）
+ETraversalFlags UTraversalSurfaceSubsystem::ResolveFlags(const UPrimitiveComponent* Component)
+{
+    if (!Component)
+    {
+        return ETraversalFlags::None;
+    }
+
+    ETraversalFlags Flags = GetMaterialFlags(Component->BodyInstance.GetSimplePhysicalMaterial());
+
+    auto AddTagFlags = [&Flags](const TArray<FName>& Tags)
+    {
+        for (const FName& Tag : Tags)
+        {
+            if (Tag == TraversalTags::NoWallRun)      { Flags |= ETraversalFlags::NoWallRun; }
+            else if (Tag == TraversalTags::NoParkour) { Flags |= ETraversalFlags::NoParkour; }
+            else if (Tag == TraversalTags::Slippery)  { Flags |= ETraversalFlags::Slippery; }
+        }
+    };
+
+    AddTagFlags(Component->ComponentTags);
+
+    if (const AActor* Owner = Component->GetOwner())
+    {
+        AddTagFlags(Owner->Tags);
+    }
+
+    return Flags;
+}
+
+ETraversalFlags UTraversalSurfaceSubsystem::GetFlagsForHit(const UWorld* World, const FHitResult& Hit)
+{
+    if (UTraversalSurfaceSubsystem* Subsystem = World ? World->GetSubsystem<UTraversalSurfaceSubsystem>() : nullptr)
+    {
+        return Subsystem->GetFlags(Hit);
+    }
+
+    return ResolveFlags(Hit.GetComponent()) | GetMaterialFlags(Hit.PhysMaterial.Get());
+}
+
+ETraversalFlags UTraversalSurfaceSubsystem::GetMaterialFlags(const UPhysicalMaterial* Material)
+{
+    const UTraversalPhysicalMaterial* TraversalMaterial = Cast<UTraversalPhysicalMaterial>(Material);
+    return TraversalMaterial ? TraversalMaterial->GetTraversalFlags() : ETraversalFlags::None;
+}
@@ -0,0 +1,74 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Object/Traversal/TraversalPhysicalMaterial.h"
+#include "TraversalSurfaceSubsystem.generated.h"
+
+/**
+ * @brief 面ごとの移動アクション可否を解決・キャッシュするサブシステム
+ *
+ * コンポーネントの物理マテリアル（UTraversalPhysicalMaterial）と、
+ * 既存レベル互換のタグ（NoWallRun / NoParkour / Slippery）から一度だけビットマスクを作り、
+ * コンポーネントIDをキーに保持する。以降の問い合わせはマップ検索1回で済む。
+ *
+ * **主な最適化**
+ * - ヒットごとのFName線形検索（ActorHasTag）をなくす
+ * - アクターを持たないヒット（BSP・ランドスケープ）も安全に扱う
+ */
+UCLASS()
+class CARRY_API UTraversalSurfaceSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    // ============================================
+    // Public API
+    // ============================================
+
+    /**
+     * @brief ヒットした面の性質を取得
+     * @details コンポーネント単位のキャッシュに、ヒット位置の物理マテリアル（ランドスケープのレイヤー等）を加える
+     */
+    ETraversalFlags GetFlags(const FHitResult& Hit);
+
+    /** @brief コンポーネントの性質を取得（キャッシュ） */
+    ETraversalFlags GetFlags(const UPrimitiveComponent* Component);
+
+    /** @brief ヒットした面が指定の性質を持つか */
+    bool HasAnyFlags(const FHitResult& Hit, ETraversalFlags Flags) { return EnumHasAnyFlags(GetFlags(Hit), Flags); }
+
+    /**
+     * @brief コンポーネントのキャッシュを破棄
+     * @details 実行中にマテリアルやタグを変更した場合に呼ぶ
+     */
+    void InvalidateComponent(const UPrimitiveComponent* Component);
+
+    /**
+     * @brief コンポーネントの性質を解決（キャッシュなし）
+     * @details エディタでの焼き込みなど、サブシステムが無い場面でも使える
+     */
+    static ETraversalFlags ResolveFlags(const UPrimitiveComponent* Component);
+
+    /** @brief ワールドのサブシステムからヒットの性質を取得（サブシステムが無ければ解決のみ） */
+    static ETraversalFlags GetFlagsForHit(const UWorld* World, const FHitResult& Hit);
+
+private:
+    /** @brief 物理マテリアルから性質を取得 */
+    static ETraversalFlags GetMaterialFlags(const UPhysicalMaterial* Material);
+
+private:
+    /** キャッシュの1件（IDの再利用に備えてコンポーネントも保持） */
+    struct FTraversalFlagEntry
+    {
+        TWeakObjectPtr<const UPrimitiveComponent> Component;
+        ETraversalFlags Flags = ETraversalFlags::None;
+    };
+
+    /** コンポーネントID → 性質 */
+    TMap<uint32, FTraversalFlagEntry> ComponentFlags;
+};
@@ -3,12 +3,36 @@
 #include "GameFramework/Character.h"
 #include "Components/WidgetComponent.h"
 #include "Blueprint/UserWidget.h"
+#include "Engine/AssetManager.h"
 #include "Component/MyLibraryComponent.h"
 
 void UUIManager::Init()
 {
-    // 全カテゴリのウィジェットを初期化
+    TArray<FSoftObjectPath> PendingPaths;
+
+    // 未読み込みのウィジェットクラスを集める
+    for (const auto& Pair : WidgetDataMap)
+    {
+        for (const auto& ClassPair : Pair.Value.WidgetClassMap)
+        {
+            if (!ClassPair.Value.IsNull() && !ClassPair.Value.IsValid())
+            {
+                PendingPaths.AddUnique(ClassPair.Value.ToSoftObjectPath());
+            }
+        }
+    }
+
+    // 読み込み済みのクラスからウィジェットを初期化
     InitAllWidgets();
+
+    // 残りは非同期で読み込み、完了後に生成
+    if (PendingPaths.Num() > 0)
+    {
+        WidgetLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+            MoveTemp(PendingPaths),
+            FStreamableDelegate::CreateUObject(this, &UUIManager::OnWidgetClassesLoaded),
+            WidgetLoadPriority);
+    }
 }
 
 void UUIManager::InitAllWidgets()
@@ -25,13 +49,14 @@ void UUIManager::InitWidgetGroup(FWidgetData& WidgetGroup)
     // 既存のインスタンスをクリア
     WidgetGroup.WidgetMap.Reset();
 
-    // クラス定義に基づき、ウィジェットを生成して登録
+    // 読み込み済みのクラス定義に基づき、ウィジェットを生成して登録
     for (auto& ClassPair : WidgetGroup.WidgetClassMap)
     {
-        if (!ClassPair.Value)
+        UClass* WidgetClass = ClassPair.Value.Get();
+        if (!WidgetClass)
             continue;
 
-        UUserWidget* NewWidget = CreateWidget<UUserWidget>(GetWorld(), ClassPair.Value);
+        UUserWidget* NewWidget = CreateWidget<UUserWidget>(GetWorld(), WidgetClass);
         if (NewWidget)
         {
             NewWidget->RemoveFromParent(); // 念のため親から外してから登録
@@ -40,6 +65,64 @@ void UUIManager::InitWidgetGroup(FWidgetData& WidgetGroup)
     }
 }
 
+void UUIManager::OnWidgetClassesLoaded()
+{
+    // 先に要求されて生成済みのウィジェットは残し、未生成のものだけ作る
+    for (auto& Pair : WidgetDataMap)
+    {
+        FWidgetData& Group = Pair.Value;
+        for (auto& ClassPair : Group.WidgetClassMap)
+        {
+            UClass* WidgetClass = ClassPair.Value.Get();
+            if (!WidgetClass || Group.WidgetMap.Contains(ClassPair.Key))
+                continue;
+
+            UUserWidget* NewWidget = CreateWidget<UUserWidget>(GetWorld(), WidgetClass);
+            if (NewWidget)
+            {
+                NewWidget->RemoveFromParent();
+                Group.WidgetMap.Add(ClassPair.Key, NewWidget);
+            }
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("UIManager: Widget classes loaded"));
+}
+
+UUserWidget* UUIManager::FindOrCreateWidget(FWidgetData& WidgetGroup, FName WidgetName)
+{
+    if (UUserWidget** FoundWidget = WidgetGroup.WidgetMap.Find(WidgetName))
+        return *FoundWidget;
+
+    const TSoftClassPtr<UUserWidget>* SoftClass = WidgetGroup.WidgetClassMap.Find(WidgetName);
+    if (!SoftClass || SoftClass->IsNull())
+        return nullptr;
+
+    // 読み込みが間に合っていない場合は、このウィジェットだけ同期読み込みする
+    UClass* WidgetClass = SoftClass->Get();
+    if (!WidgetClass)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UIManager: %s requested before async load finished, loading synchronously"), *WidgetName.ToString());
+        WidgetClass = SoftClass->LoadSynchronous();
+    }
+    if (!WidgetClass)
+        return nullptr;
+
+    UUserWidget* NewWidget = CreateWidget<UUserWidget>(GetWorld(), WidgetClass);
+    if (NewWidget)
+    {
+        NewWidget->RemoveFromParent();
+        WidgetGroup.WidgetMap.Add(WidgetName, NewWidget);
+    }
+    return NewWidget;
+}
+
+bool UUIManager::IsWidgetReady(EWidgetCategory CategoryName, FName WidgetName) const
+{
+    const FWidgetData* Group = WidgetDataMap.Find(CategoryName);
+    return Group && Group->WidgetMap.Contains(WidgetName);
+}
+
 void UUIManager::CreateWidgetArray(const TArray<TSubclassOf<UUserWidget>>& Classes, TArray<UUserWidget*>& Widgets)
 {
     // 複数クラスからウィジェットを生成する汎用関数
@@ -68,7 +151,7 @@ UUserWidget* UUIManager::ShowWidget(EWidgetCategory CategoryName, FName WidgetNa
         return widget;
 
     FWidgetData& Group = WidgetDataMap[CategoryName];
-    UUserWidget** FoundWidget = Group.WidgetMap.Find(WidgetName);
+    UUserWidget* FoundWidget = FindOrCreateWidget(Group, WidgetName);
     if (FoundWidget == nullptr)
         return widget;
 
@@ -83,7 +166,7 @@ UUserWidget* UUIManager::ShowWidget(EWidgetCategory CategoryName, FName WidgetNa
     }
 
     // 新しく表示リストに追加
-    Group.CurrentWidget.Add(WidgetName, *FoundWidget);
+    Group.CurrentWidget.Add(WidgetName, FoundWidget);
     Group.CurrentWidget[WidgetName]->AddToViewport();
 
     widget = Group.CurrentWidget[WidgetName];
@@ -124,11 +207,7 @@ UUserWidget* UUIManager::GetWidget(EWidgetCategory CategoryName, FName WidgetNam
         return nullptr;
 
     FWidgetData& Group = WidgetDataMap[CategoryName];
-    UUserWidget** FoundWidget = Group.WidgetMap.Find(WidgetName);
-    if (!FoundWidget)
-        return nullptr;
-
-    return *FoundWidget;
+    return FindOrCreateWidget(Group, WidgetName);
 }
 
 bool UUIManager::PlayWidgetAnimation(EWidgetCategory CategoryName, FName WidgetName, FName AnimationName)
@@ -6,6 +6,7 @@
 #include "UI/UIWidgetBase.h"
 #include "Interface/UIManagerProvider.h"
 #include "Containers/Map.h"
+#include "Engine/StreamableManager.h"
 #include "UIManager.generated.h"
 
 /**
@@ -16,9 +17,9 @@ struct FWidgetData : public FTableRowBase
 {
     GENERATED_USTRUCT_BODY()
 
-    // ウィジェット名に対応するウィジェットクラス
+    // ウィジェット名に対応するウィジェットクラス（Init後に非同期で読み込む）
     UPROPERTY(EditAnywhere, Category = "UI")
-    TMap<FName, TSubclassOf<UUserWidget>> WidgetClassMap;
+    TMap<FName, TSoftClassPtr<UUserWidget>> WidgetClassMap;
 
     // 実行時に生成されたウィジェットのインスタンスを保持
     UPROPERTY(Transient)
@@ -45,6 +46,13 @@ public:
      */
     virtual void Init();
 
+    /**
+     * @brief 指定ウィジェットが生成済みで、すぐに表示できる状態か
+     * @param CategoryName ウィジェットカテゴリ
+     * @param WidgetName ウィジェット名
+     */
+    bool IsWidgetReady(EWidgetCategory CategoryName, FName WidgetName) const;
+
     // 汎用プロパティ設定（シンプルなラッパー）
     template<typename T>
     bool SetWidgetProperty(EWidgetCategory CategoryName, FName WidgetName, FName PropertyName, const T& Value);
@@ -112,6 +120,17 @@ private:
      */
     void InitWidgetGroup(FWidgetData& WidgetGroup);
 
+    /** @brief 非同期読み込み完了時の処理（読み込めたクラスのウィジェットを生成） */
+    void OnWidgetClassesLoaded();
+
+    /**
+     * @brief 生成済みのウィジェットを返す。未生成ならクラスを同期読み込みして生成
+     * @param WidgetGroup 対象カテゴリのウィジェットデータ
+     * @param WidgetName ウィジェット名
+     * @return UUserWidget* ポインタ（クラス未登録なら nullptr）
+     */
+    UUserWidget* FindOrCreateWidget(FWidgetData& WidgetGroup, FName WidgetName);
+
     /**
      * @brief 配列形式ウィジェットの生成（CrossHair等旧仕様対応）
      * @param WidgetClasses 生成するウィジェットクラス配列
@@ -137,6 +156,13 @@ private:
     UPROPERTY(EditAnywhere, Category = "UI")
     TMap<EWidgetCategory, FWidgetData> WidgetDataMap;
 
+    /** @brief ウィジェットクラス読み込みの優先度 */
+    UPROPERTY(EditAnywhere, Category = "UI")
+    int32 WidgetLoadPriority = FStreamableManager::DefaultAsyncLoadPriority;
+
+    /** @brief ウィジェットクラスの読み込みハンドル（保持している間は解放されない） */
+    TSharedPtr<FStreamableHandle> WidgetLoadHandle;
+
 };
 
 template<typename T>
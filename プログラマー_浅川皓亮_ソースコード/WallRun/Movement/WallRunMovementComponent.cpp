@@ -0,0 +1,193 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Component/WallRun/WallRunMovementComponent.h"
+#include "GameFramework/Character.h"
+#include "Components/CapsuleComponent.h"
+
+void UWallRunMovementComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UWorld* World = GetWorld())
+    {
+        TraceScheduler = World->GetSubsystem<UTraceSchedulerSubsystem>();
+    }
+}
+
+// ============================================
+// Wall Run Mode
+// ============================================
+
+// 処理の流れ:
+// 1. 方向・法線・速度を保存
+// 2. 壁に沿った速度を設定して MOVE_Custom へ移行
+void UWallRunMovementComponent::BeginWallRun(const FVector& MoveDirection, const FVector& WallNormal, float Speed)
+{
+    WallRunDirection = FVector(MoveDirection.X, MoveDirection.Y, 0.0f).GetSafeNormal();
+    WallRunNormal = WallNormal;
+    WallRunSpeed = Speed;
+
+    if (WallRunDirection.IsNearlyZero())
+    {
+        UE_LOG(LogTemp, Error, TEXT("WallRunMovement: Move direction is zero!"));
+        return;
+    }
+
+    Velocity = WallRunDirection * WallRunSpeed;
+    SetMovementMode(MOVE_Custom, static_cast<uint8>(ECustomMovementMode::CMOVE_WallRun));
+}
+
+void UWallRunMovementComponent::EndWallRun()
+{
+    if (!IsWallRunning())
+    {
+        return;
+    }
+
+    bEndingWallRunByRequest = true;
+    SetMovementMode(MOVE_Falling);
+    bEndingWallRunByRequest = false;
+}
+
+// 処理の流れ:
+// 1. 壁走りモードを抜けたら状態をクリア
+// 2. 外部からの要求でなければイベントを発行
+void UWallRunMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
+{
+    Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
+
+    const bool bWasWallRunning = PreviousMovementMode == MOVE_Custom
+        && PreviousCustomMode == static_cast<uint8>(ECustomMovementMode::CMOVE_WallRun);
+
+    if (!bWasWallRunning || IsWallRunning())
+    {
+        return;
+    }
+
+    WallRunDirection = FVector::ZeroVector;
+    WallRunNormal = FVector::ZeroVector;
+
+    if (!bEndingWallRunByRequest)
+    {
+        OnWallRunModeEnded.Broadcast();
+    }
+}
+
+float UWallRunMovementComponent::GetMaxSpeed() const
+{
+    return IsWallRunning() ? WallRunSpeed : Super::GetMaxSpeed();
+}
+
+void UWallRunMovementComponent::PhysCustom(float DeltaTime, int32 Iterations)
+{
+    if (IsCustomMovementMode(ECustomMovementMode::CMOVE_WallRun))
+    {
+        PhysWallRun(DeltaTime, Iterations);
+    }
+
+    Super::PhysCustom(DeltaTime, Iterations);
+}
+
+// 処理の流れ:
+// 1. 方向が無い（巻き戻しで復元された等）場合は落下へ
+// 2. 壁に沿った速度 + 壁への押し付けで移動し、衝突は壁に沿って滑らせる
+// 3. 床に着いたら歩行へ移行
+// 4. 実際に進んだ速度を Velocity にして継続条件を問い合わせ、満たさなければ落下へ移行
+void UWallRunMovementComponent::PhysWallRun(float DeltaTime, int32 Iterations)
+{
+    if (DeltaTime < MIN_TICK_TIME)
+    {
+        return;
+    }
+
+    if (WallRunDirection.IsNearlyZero() || !UpdatedComponent)
+    {
+        SetMovementMode(MOVE_Falling);
+        return;
+    }
+
+    RestorePreAdditiveRootMotionVelocity();
+
+    // 水平の一定速度（重力なし）
+    Velocity = WallRunDirection * WallRunSpeed;
+
+    const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+    const FVector Delta = (Velocity - WallRunNormal * WallStickSpeed) * DeltaTime;
+
+    FHitResult Hit(1.0f);
+    SafeMoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, Hit);
+
+    // 滑らせる移動で上書きされる前の衝突（壁の存在確認に使う）
+    const FHitResult MoveHit = Hit;
+
+    if (Hit.IsValidBlockingHit())
+    {
+        // 床に着いた
+        if (IsWalkable(Hit))
+        {
+            ProcessLanded(Hit, DeltaTime, Iterations);
+            return;
+        }
+
+        HandleImpact(Hit, DeltaTime, Delta);
+        SlideAlongSurface(Delta, 1.0f - Hit.Time, Hit.Normal, Hit, true);
+    }
+
+    // 押し付け分は速度に含めず、正面の障害物などで進めなかった分は速度から引く
+    const FVector Moved = UpdatedComponent->GetComponentLocation() - OldLocation;
+    const float ActualSpeed = FMath::Max(0.0f, FVector::DotProduct(Moved, WallRunDirection) / DeltaTime);
+    Velocity = WallRunDirection * ActualSpeed;
+
+    const bool bWallStillAdjacent = IsWallStillAdjacent(MoveHit);
+    const bool bCanContinue = CanContinueWallRunMode.IsBound()
+        ? CanContinueWallRunMode.Execute(bWallStillAdjacent)
+        : bWallStillAdjacent;
+
+    if (!bCanContinue)
+    {
+        SetMovementMode(MOVE_Falling);
+    }
+}
+
+// 処理の流れ:
+// 1. このステップの移動で壁側の面に当たっていれば、それを壁ありとして使う（トレースなし）
+// 2. そうでなければ壁方向へ短い球Sweep
+//    - スケジューラがあれば Urgent で実行し、フレームのトレース数に含める
+//    - なければ直接実行
+bool UWallRunMovementComponent::IsWallStillAdjacent(const FHitResult& MoveHit) const
+{
+    const ACharacter* Character = GetCharacterOwner();
+    if (!Character || WallRunNormal.IsNearlyZero())
+    {
+        return false;
+    }
+
+    // 押し付けで壁に当たっている
+    if (MoveHit.IsValidBlockingHit() && FVector::DotProduct(MoveHit.Normal, WallRunNormal) > 0.7f)
+    {
+        return true;
+    }
+
+    const UCapsuleComponent* Capsule = Character->GetCapsuleComponent();
+
+    FTraceRequest Request;
+    Request.Start = UpdatedComponent->GetComponentLocation();
+    Request.End = Request.Start - WallRunNormal * WallCheckDistance;
+    Request.Shape = FCollisionShape::MakeSphere(Capsule->GetScaledCapsuleRadius() * 0.5f);
+    Request.Channel = UpdatedComponent->GetCollisionObjectType();
+    Request.Params = FCollisionQueryParams(SCENE_QUERY_STAT(WallRunAdjacent), false, Character);
+    Request.Priority = ETracePriority::Urgent;
+    Request.Requester = this;
+
+    FHitResult Hit;
+    if (TraceScheduler.IsValid())
+    {
+        return TraceScheduler->ExecuteImmediate(Request, Hit);
+    }
+
+    FCollisionResponseParams ResponseParams;
+    InitCollisionParams(Request.Params, ResponseParams);
+    return GetWorld()->SweepSingleByChannel(Hit, Request.Start, Request.End, FQuat::Identity,
+        Request.Channel, Request.Shape, Request.Params, ResponseParams);
+}
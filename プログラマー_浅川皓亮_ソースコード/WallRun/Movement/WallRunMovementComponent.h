@@ -0,0 +1,120 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "SubSystem/TraceSchedulerSubsystem.h"
+#include "WallRunMovementComponent.generated.h"
+
+/**
+ * @brief プロジェクト独自の移動モード（MOVE_Custom のサブモード）
+ */
+UENUM(BlueprintType)
+enum class ECustomMovementMode : uint8
+{
+    CMOVE_None      UMETA(Hidden),
+    CMOVE_WallRun   UMETA(DisplayName = "Wall Run"),
+};
+
+/**
+ * @brief 壁走りモードが移動コンポーネント側の判断で終了した際に呼び出されるイベント
+ * @details 着地・壁との衝突・速度不足など。UWallRunComponent が状態を合わせるのに使う
+ */
+DECLARE_MULTICAST_DELEGATE(FOnWallRunModeEnded);
+
+/**
+ * @brief 壁走りモードを継続できるかの問い合わせ
+ * @param bool 壁がまだ横にあるか
+ * @return 継続できる場合 true
+ * @details 移動後の速度（Velocity）で判定する。UWallRunComponent が継続条件を返す
+ */
+DECLARE_DELEGATE_RetVal_OneParam(bool, FCanContinueWallRunMode, bool);
+
+/**
+ * @brief 壁走りを MOVE_Custom として解く移動コンポーネント
+ *
+ * 壁走り中の速度は PhysCustom 内で毎フレーム一度だけ求めるため、
+ * 重力スケールや歩行速度を書き換えたり、シミュレーション後に速度を上書きしたりしない。
+ * 方向・速度の計算は UWallRunLogicComponent が行い、ここでは移動の解決だけを担当する。
+ */
+UCLASS()
+class CARRY_API UWallRunMovementComponent : public UCharacterMovementComponent
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief 壁走りモードへ移行
+     * @param MoveDirection 壁に沿った移動方向
+     * @param WallNormal 壁の法線
+     * @param Speed 壁走り速度
+     */
+    void BeginWallRun(const FVector& MoveDirection, const FVector& WallNormal, float Speed);
+
+    /**
+     * @brief 壁走りモードを終了して落下へ移行
+     */
+    void EndWallRun();
+
+    /** @brief 壁走りモード中か */
+    bool IsWallRunning() const { return IsCustomMovementMode(ECustomMovementMode::CMOVE_WallRun); }
+
+    /** @brief 指定した独自モード中か */
+    bool IsCustomMovementMode(ECustomMovementMode Mode) const
+    {
+        return MovementMode == MOVE_Custom && CustomMovementMode == static_cast<uint8>(Mode);
+    }
+
+    /** 壁走りモードが移動コンポーネント側で終了した */
+    FOnWallRunModeEnded OnWallRunModeEnded;
+
+    /** 壁走りモードの継続条件（未設定なら壁があるかだけで判定） */
+    FCanContinueWallRunMode CanContinueWallRunMode;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void PhysCustom(float DeltaTime, int32 Iterations) override;
+    virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
+    virtual float GetMaxSpeed() const override;
+
+private:
+    /**
+     * @brief 壁走り中の移動を解く
+     * @details 壁に沿った一定速度で移動し、壁方向へ軽く押し付ける。
+     *          床に着いた場合や、継続条件（CanContinueWallRunMode）を満たさない場合はモードを抜ける
+     */
+    void PhysWallRun(float DeltaTime, int32 Iterations);
+
+    /**
+     * @brief 壁がまだ横にあるか
+     * @param MoveHit このステップの移動で当たった面
+     * @details 移動で壁に当たっていればその結果を使い、そうでなければ
+     *          壁方向へ短いSweepをトレーススケジューラ経由（Urgent）で行う
+     */
+    bool IsWallStillAdjacent(const FHitResult& MoveHit) const;
+
+private:
+    /** 壁に押し付ける速度（壁から離れないようにする） */
+    UPROPERTY(EditAnywhere, Category = "Character Movement: Wall Run", meta = (ClampMin = "0.0"))
+    float WallStickSpeed = 200.0f;
+
+    /** 壁の存在確認に使う距離 */
+    UPROPERTY(EditAnywhere, Category = "Character Movement: Wall Run", meta = (ClampMin = "1.0"))
+    float WallCheckDistance = 50.0f;
+
+    /** トレーススケジューラ（キャッシュ） */
+    TWeakObjectPtr<UTraceSchedulerSubsystem> TraceScheduler;
+
+    /** 壁に沿った移動方向 */
+    FVector WallRunDirection = FVector::ZeroVector;
+
+    /** 現在の壁の法線 */
+    FVector WallRunNormal = FVector::ZeroVector;
+
+    /** 壁走り速度 */
+    float WallRunSpeed = 0.0f;
+
+    /** EndWallRun による終了か（イベントを発行しない） */
+    bool bEndingWallRunByRequest = false;
+};
@@ -0,0 +1,313 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Object/WallRun/WallRunSurfaceBakeVolume.h"
+#include "Object/WallRun/WallRunSurfaceIndex.h"
+#include "SubSystem/TraversalSurfaceSubsystem.h"
+#include "Components/BoxComponent.h"
+#include "Engine/World.h"
+
+AWallRunSurfaceBakeVolume::AWallRunSurfaceBakeVolume()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    Bounds = CreateDefaultSubobject<UBoxComponent>(TEXT("Bounds"));
+    RootComponent = Bounds;
+    Bounds->InitBoxExtent(FVector(1000.f));
+
+    // 範囲指定のためだけに使う
+    Bounds->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Bounds->SetGenerateOverlapEvents(false);
+}
+
+#if WITH_EDITOR
+namespace
+{
+    /** 同一平面のヒットをまとめるキー */
+    struct FSurfacePlaneKey
+    {
+        TWeakObjectPtr<UPrimitiveComponent> Component;
+        FIntVector QuantizedNormal;
+        int32 QuantizedDistance = 0;
+
+        bool operator==(const FSurfacePlaneKey& Other) const
+        {
+            return Component == Other.Component
+                && QuantizedNormal == Other.QuantizedNormal
+                && QuantizedDistance == Other.QuantizedDistance;
+        }
+
+        friend uint32 GetTypeHash(const FSurfacePlaneKey& Key)
+        {
+            return HashCombine(HashCombine(GetTypeHash(Key.Component), GetTypeHash(Key.QuantizedNormal)),
+                GetTypeHash(Key.QuantizedDistance));
+        }
+    };
+
+    /** 平面ごとの集計 */
+    struct FSurfacePlaneAccumulator
+    {
+        FVector NormalSum = FVector::ZeroVector;
+        TArray<FVector> Points;
+        AActor* Actor = nullptr;
+        UPrimitiveComponent* Component = nullptr;
+    };
+
+    /** 平面上の占有セルの矩形（セル座標、両端を含む） */
+    struct FOccupiedRect
+    {
+        FIntPoint Min;
+        FIntPoint Max;
+    };
+
+    // 処理の流れ:
+    // 1. 面内座標をサンプル間隔のセルに丸めて占有グリッドを作る
+    // 2. 行ごとに連続した占有セルの区間を探す
+    // 3. 同じ区間が下の行でも埋まっている限り伸ばして矩形にする
+    //    （隙間・開口部をまたぐ矩形は作らない）
+    void SplitIntoRects(const TArray<FVector2f>& Points, const FVector2f& Origin, float Spacing, TArray<FOccupiedRect>& OutRects)
+    {
+        FIntPoint GridSize(0, 0);
+        TArray<FIntPoint> Cells;
+        Cells.Reserve(Points.Num());
+        for (const FVector2f& Point : Points)
+        {
+            const FIntPoint Cell(
+                FMath::RoundToInt((Point.X - Origin.X) / Spacing),
+                FMath::RoundToInt((Point.Y - Origin.Y) / Spacing));
+            GridSize.X = FMath::Max(GridSize.X, Cell.X + 1);
+            GridSize.Y = FMath::Max(GridSize.Y, Cell.Y + 1);
+            Cells.Add(Cell);
+        }
+
+        TBitArray<> Occupied(false, GridSize.X * GridSize.Y);
+        for (const FIntPoint& Cell : Cells)
+        {
+            Occupied[Cell.Y * GridSize.X + Cell.X] = true;
+        }
+
+        // 占有されていて、まだどの矩形にも使われていないセルか
+        auto IsUnclaimedOccupied = [&](int32 X, int32 Y) { return Occupied[Y * GridSize.X + X]; };
+
+        for (int32 Y = 0; Y < GridSize.Y; ++Y)
+        {
+            int32 X = 0;
+            while (X < GridSize.X)
+            {
+                if (!IsUnclaimedOccupied(X, Y))
+                {
+                    ++X;
+                    continue;
+                }
+
+                // 横方向に連続する区間
+                const int32 StartX = X;
+                while (X < GridSize.X && IsUnclaimedOccupied(X, Y))
+                {
+                    ++X;
+                }
+                const int32 EndX = X - 1;
+
+                // 同じ区間が埋まっている限り下の行へ伸ばす
+                int32 EndY = Y;
+                for (int32 NextY = Y + 1; NextY < GridSize.Y; ++NextY)
+                {
+                    bool bRowFilled = true;
+                    for (int32 RowX = StartX; RowX <= EndX && bRowFilled; ++RowX)
+                    {
+                        bRowFilled = IsUnclaimedOccupied(RowX, NextY);
+                    }
+                    if (!bRowFilled)
+                    {
+                        break;
+                    }
+                    EndY = NextY;
+                }
+
+                // 使ったセルは以降の矩形に含めない
+                for (int32 RectY = Y; RectY <= EndY; ++RectY)
+                {
+                    for (int32 RectX = StartX; RectX <= EndX; ++RectX)
+                    {
+                        Occupied[RectY * GridSize.X + RectX] = false;
+                    }
+                }
+
+                OutRects.Add({ FIntPoint(StartX, Y), FIntPoint(EndX, EndY) });
+            }
+        }
+    }
+}
+
+// 処理の流れ:
+// 1. 範囲内を格子状にサンプリングし、水平8方向へ静的ジオメトリのみをトレース
+// 2. 壁走り禁止の面と、床・天井とみなせる水平な面を除外
+//    （壁の角度は実行時に UWallDetectionComponent の設定で判定する）
+// 3. コンポーネント・量子化した法線・平面距離でヒットをまとめる
+// 4. 平面ごとに点群を隙間で区切った矩形に分けて面にする
+// 5. インデックスへ保存しグリッドを構築
+void AWallRunSurfaceBakeVolume::BakeSurfaces()
+{
+    UWorld* World = GetWorld();
+    if (!World || !TargetIndex)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("WallRunSurfaceBakeVolume: TargetIndex is not set"));
+        return;
+    }
+
+    const FBox Box = Bounds->Bounds.GetBox();
+    const float NormalQuantize = FMath::Sin(FMath::DegreesToRadians(NormalQuantizeDegrees));
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(WallRunSurfaceBake), false, this);
+    Params.MobilityType = EQueryMobilityType::Static;
+    Params.bReturnPhysicalMaterial = true;
+
+    static constexpr int32 DirectionCount = 8;
+    FVector Directions[DirectionCount];
+    for (int32 i = 0; i < DirectionCount; ++i)
+    {
+        const float Angle = 2.0f * PI * i / DirectionCount;
+        Directions[i] = FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f);
+    }
+
+    // ========================================
+    // サンプリング
+    // ========================================
+    TMap<FSurfacePlaneKey, FSurfacePlaneAccumulator> Planes;
+    FHitResult Hit;
+
+    for (float Z = Box.Min.Z; Z <= Box.Max.Z; Z += SampleSpacing)
+    {
+        for (float Y = Box.Min.Y; Y <= Box.Max.Y; Y += SampleSpacing)
+        {
+            for (float X = Box.Min.X; X <= Box.Max.X; X += SampleSpacing)
+            {
+                const FVector Start(X, Y, Z);
+
+                for (const FVector& Direction : Directions)
+                {
+                    if (!World->LineTraceSingleByChannel(Hit, Start, Start + Direction * TraceLength, TraceChannel, Params)
+                        || Hit.bStartPenetrating)
+                    {
+                        continue;
+                    }
+
+                    AActor* HitActor = Hit.GetActor();
+                    UPrimitiveComponent* HitComponent = Hit.GetComponent();
+                    if (!HitComponent
+                        || EnumHasAnyFlags(UTraversalSurfaceSubsystem::GetFlagsForHit(World, Hit), ETraversalFlags::NoWallRun))
+                    {
+                        continue;
+                    }
+
+                    // 水平な面（床・天井）は面内の水平方向が定まらないので除外
+                    const FVector Normal = Hit.ImpactNormal;
+                    if (FMath::Abs(Normal.Z) > 1.0f - KINDA_SMALL_NUMBER)
+                    {
+                        continue;
+                    }
+
+                    FSurfacePlaneKey Key;
+                    Key.Component = HitComponent;
+                    Key.QuantizedNormal = FIntVector(
+                        FMath::RoundToInt(Normal.X / NormalQuantize),
+                        FMath::RoundToInt(Normal.Y / NormalQuantize),
+                        FMath::RoundToInt(Normal.Z / NormalQuantize));
+                    Key.QuantizedDistance = FMath::RoundToInt(FVector::DotProduct(Hit.ImpactPoint, Normal) / PlaneQuantizeDistance);
+
+                    FSurfacePlaneAccumulator& Plane = Planes.FindOrAdd(Key);
+                    Plane.NormalSum += Normal;
+                    Plane.Points.Add(Hit.ImpactPoint);
+                    Plane.Actor = HitActor;
+                    Plane.Component = HitComponent;
+                }
+            }
+        }
+    }
+
+    // ========================================
+    // 平面ごとに矩形化
+    // ========================================
+    TArray<FWallRunSurface> Surfaces;
+    TArray<TSoftObjectPtr<AActor>> SourceActors;
+    TArray<TSoftObjectPtr<UPrimitiveComponent>> SourceComponents;
+    TMap<AActor*, int32> ActorToIndex;
+    TMap<UPrimitiveComponent*, int32> ComponentToIndex;
+    TArray<FVector2f> PlanePoints;
+    TArray<FOccupiedRect> Rects;
+
+    for (const TPair<FSurfacePlaneKey, FSurfacePlaneAccumulator>& Pair : Planes)
+    {
+        const FSurfacePlaneAccumulator& Plane = Pair.Value;
+        const FVector Normal = Plane.NormalSum.GetSafeNormal();
+        if (Normal.IsNearlyZero() || Plane.Points.Num() == 0)
+        {
+            continue;
+        }
+
+        FWallRunSurface Surface;
+        Surface.Normal = FVector3f(Normal);
+        Surface.Flags = static_cast<uint8>(EWallRunSurfaceFlags::Runnable);
+
+        if (Plane.Actor)
+        {
+            if (const int32* Found = ActorToIndex.Find(Plane.Actor))
+            {
+                Surface.ActorIndex = *Found;
+            }
+            else
+            {
+                Surface.ActorIndex = SourceActors.Add(Plane.Actor);
+                ActorToIndex.Add(Plane.Actor, Surface.ActorIndex);
+            }
+        }
+
+        if (const int32* Found = ComponentToIndex.Find(Plane.Component))
+        {
+            Surface.ComponentIndex = *Found;
+        }
+        else
+        {
+            Surface.ComponentIndex = SourceComponents.Add(Plane.Component);
+            ComponentToIndex.Add(Plane.Component, Surface.ComponentIndex);
+        }
+
+        // 平面の基底（Tangent / Bitangent）へ点群を投影
+        const FVector Tangent = Surface.GetTangent();
+        const FVector Bitangent = Surface.GetBitangent();
+
+        PlanePoints.Reset();
+        float PlaneDistance = 0.0f;
+        FVector2f Min(TNumericLimits<float>::Max());
+        for (const FVector& Point : Plane.Points)
+        {
+            const FVector2f UV(FVector::DotProduct(Point, Tangent), FVector::DotProduct(Point, Bitangent));
+            Min = FVector2f::Min(Min, UV);
+            PlanePoints.Add(UV);
+            PlaneDistance += FVector::DotProduct(Point, Normal);
+        }
+        PlaneDistance /= Plane.Points.Num();
+
+        // 隙間で区切った矩形ごとに面を作る
+        // （斜めの壁ではヒットの間隔が最大でサンプル間隔の√2倍になるので、セルをその大きさにする）
+        const float CellSpacing = SampleSpacing * UE_SQRT_2;
+        Rects.Reset();
+        SplitIntoRects(PlanePoints, Min, CellSpacing, Rects);
+
+        for (const FOccupiedRect& Rect : Rects)
+        {
+            // セルの半分だけ広げて、端のサンプル間を埋める
+            const FVector2f Center = Min + FVector2f(Rect.Min + Rect.Max) * (CellSpacing * 0.5f);
+            Surface.HalfExtent = FVector2f(Rect.Max - Rect.Min) * (CellSpacing * 0.5f) + FVector2f(CellSpacing * 0.5f);
+            Surface.Center = Tangent * Center.X + Bitangent * Center.Y + Normal * PlaneDistance;
+
+            Surfaces.Add(Surface);
+        }
+    }
+
+    // ========================================
+    // 保存
+    // ========================================
+    TargetIndex->Build(MoveTemp(Surfaces), MoveTemp(SourceActors), MoveTemp(SourceComponents), Box, CellSize);
+}
+#endif
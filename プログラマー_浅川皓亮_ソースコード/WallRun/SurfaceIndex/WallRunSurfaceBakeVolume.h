@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "WallRunSurfaceBakeVolume.generated.h"
+
+class UBoxComponent;
+class UWallRunSurfaceIndex;
+
+/**
+ * @brief 壁走り可能な面を UWallRunSurfaceIndex に焼き込む範囲
+ *
+ * エディタの「Bake Surfaces」で範囲内の静的ジオメトリをトレースし、
+ * 同一平面のヒットを、隙間（開口部など）で分けた矩形にまとめてインデックスへ保存する。
+ * 壁とみなす角度はここでは判定せず、実行時に UWallDetectionComponent の設定で判定する。
+ * 実行時は UWallDetectionComponent がこの範囲内でインデックスを優先して使う。
+ */
+UCLASS()
+class CARRY_API AWallRunSurfaceBakeVolume : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AWallRunSurfaceBakeVolume();
+
+    /** @brief 焼き込み先のインデックス */
+    UWallRunSurfaceIndex* GetSurfaceIndex() const { return TargetIndex; }
+
+#if WITH_EDITOR
+    /**
+     * @brief 範囲内の壁面を焼き込む
+     */
+    UFUNCTION(CallInEditor, Category = "Wall Run")
+    void BakeSurfaces();
+#endif
+
+private:
+    /** 範囲 */
+    UPROPERTY(VisibleAnywhere, Category = "Wall Run")
+    UBoxComponent* Bounds;
+
+    /** 焼き込み先 */
+    UPROPERTY(EditAnywhere, Category = "Wall Run")
+    UWallRunSurfaceIndex* TargetIndex;
+
+    /** サンプリング間隔 */
+    UPROPERTY(EditAnywhere, Category = "Wall Run", meta = (ClampMin = "10.0"))
+    float SampleSpacing = 50.0f;
+
+    /** 各サンプル点からのトレース距離 */
+    UPROPERTY(EditAnywhere, Category = "Wall Run", meta = (ClampMin = "10.0"))
+    float TraceLength = 100.0f;
+
+    /** 同一平面とみなす法線の量子化単位（度） */
+    UPROPERTY(EditAnywhere, Category = "Wall Run", meta = (ClampMin = "1.0"))
+    float NormalQuantizeDegrees = 5.0f;
+
+    /** 同一平面とみなす平面距離の量子化単位 */
+    UPROPERTY(EditAnywhere, Category = "Wall Run", meta = (ClampMin = "1.0"))
+    float PlaneQuantizeDistance = 10.0f;
+
+    /** インデックスのセルサイズ */
+    UPROPERTY(EditAnywhere, Category = "Wall Run", meta = (ClampMin = "50.0"))
+    float CellSize = 400.0f;
+
+    /** トレースチャンネル */
+    UPROPERTY(EditAnywhere, Category = "Wall Run")
+    TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+};
@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Object/WallRun/WallRunSurfaceIndex.h"
+#include "Components/PrimitiveComponent.h"
+
+FVector FWallRunSurface::GetTangent() const
+{
+    const FVector N(Normal);
+    const FVector Tangent = FVector::CrossProduct(FVector::UpVector, N).GetSafeNormal();
+    return Tangent.IsNearlyZero() ? FVector::ForwardVector : Tangent;
+}
+
+FVector FWallRunSurface::GetBitangent() const
+{
+    return FVector::CrossProduct(FVector(Normal), GetTangent());
+}
+
+// 処理の流れ:
+// 1. 問い合わせ範囲が覆うセルの面を列挙
+// 2. 面ごとに距離を計算し、範囲内なら Visitor を呼ぶ
+//    （複数セルにまたがる面は重複して渡ることがある）
+void UWallRunSurfaceIndex::ForEachSurfaceNear(const FVector& Location, float MaxDistance,
+    TFunctionRef<void(int32 SurfaceIndex, const FWallRunSurface& Surface, float Distance, const FVector& ImpactPoint)> Visitor) const
+{
+    Grid.ForEachElementNear(Surfaces, Location, MaxDistance,
+        [&](int32 SurfaceIndex, const FWallRunSurface& Surface)
+        {
+            float Distance = 0.0f;
+            FVector ImpactPoint;
+            if (ProjectOntoSurface(Surface, Location, MaxDistance, Distance, ImpactPoint))
+            {
+                Visitor(SurfaceIndex, Surface, Distance, ImpactPoint);
+            }
+        });
+}
+
+bool UWallRunSurfaceIndex::IsSurfaceInReach(int32 SurfaceIndex, const FVector& Location, float MaxDistance) const
+{
+    if (!Surfaces.IsValidIndex(SurfaceIndex))
+    {
+        return false;
+    }
+
+    float Distance = 0.0f;
+    FVector ImpactPoint;
+    return ProjectOntoSurface(Surfaces[SurfaceIndex], Location, MaxDistance, Distance, ImpactPoint);
+}
+
+AActor* UWallRunSurfaceIndex::GetSurfaceActor(int32 SurfaceIndex) const
+{
+    if (!Surfaces.IsValidIndex(SurfaceIndex))
+    {
+        return nullptr;
+    }
+
+    const int32 ActorIndex = Surfaces[SurfaceIndex].ActorIndex;
+    return SourceActors.IsValidIndex(ActorIndex) ? SourceActors[ActorIndex].Get() : nullptr;
+}
+
+UPrimitiveComponent* UWallRunSurfaceIndex::GetSurfaceComponent(int32 SurfaceIndex) const
+{
+    if (!Surfaces.IsValidIndex(SurfaceIndex))
+    {
+        return nullptr;
+    }
+
+    const int32 ComponentIndex = Surfaces[SurfaceIndex].ComponentIndex;
+    return SourceComponents.IsValidIndex(ComponentIndex) ? SourceComponents[ComponentIndex].Get() : nullptr;
+}
+
+// 処理の流れ:
+// 1. 法線方向の距離を求める（裏側・遠すぎる場合は対象外）
+// 2. 面上へ投影し、矩形の範囲内か確認
+bool UWallRunSurfaceIndex::ProjectOntoSurface(const FWallRunSurface& Surface, const FVector& Location, float MaxDistance,
+    float& OutDistance, FVector& OutImpactPoint) const
+{
+    const FVector Normal(Surface.Normal);
+    const FVector Offset = Location - Surface.Center;
+
+    OutDistance = FVector::DotProduct(Offset, Normal);
+    if (OutDistance < 0.0f || OutDistance > MaxDistance)
+    {
+        return false;
+    }
+
+    const float U = FVector::DotProduct(Offset, Surface.GetTangent());
+    const float V = FVector::DotProduct(Offset, Surface.GetBitangent());
+    if (FMath::Abs(U) > Surface.HalfExtent.X || FMath::Abs(V) > Surface.HalfExtent.Y)
+    {
+        return false;
+    }
+
+    OutImpactPoint = Location - Normal * OutDistance;
+    return true;
+}
+
+#if WITH_EDITOR
+// 処理の流れ:
+// 1. 面を保存
+// 2. 各面の矩形を包むXY範囲でグリッドを構築
+void UWallRunSurfaceIndex::Build(TArray<FWallRunSurface>&& InSurfaces, TArray<TSoftObjectPtr<AActor>>&& InSourceActors,
+    TArray<TSoftObjectPtr<UPrimitiveComponent>>&& InSourceComponents, const FBox& InBounds, float InCellSize)
+{
+    Surfaces = MoveTemp(InSurfaces);
+    SourceActors = MoveTemp(InSourceActors);
+    SourceComponents = MoveTemp(InSourceComponents);
+
+    Grid.Build(Surfaces, [](const FWallRunSurface& Surface)
+        {
+            const FVector T = Surface.GetTangent() * Surface.HalfExtent.X;
+            const FVector B = Surface.GetBitangent() * Surface.HalfExtent.Y;
+
+            FBox SurfaceBox(ForceInit);
+            SurfaceBox += Surface.Center + T + B;
+            SurfaceBox += Surface.Center + T - B;
+            SurfaceBox += Surface.Center - T + B;
+            SurfaceBox += Surface.Center - T - B;
+            return SurfaceBox;
+        }, InBounds, InCellSize);
+
+    MarkPackageDirty();
+
+    const FIntPoint GridSize = Grid.GetGridSize();
+    UE_LOG(LogTemp, Log, TEXT("WallRunSurfaceIndex: Built %d surfaces in %dx%d cells"),
+        Surfaces.Num(), GridSize.X, GridSize.Y);
+}
+#endif
@@ -0,0 +1,159 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Object/Traversal/TraversalCellGrid.h"
+#include "WallRunSurfaceIndex.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * @brief 焼き込み済み壁面のフラグ
+ */
+UENUM(meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EWallRunSurfaceFlags : uint8
+{
+    None     = 0,
+    Runnable = 1 << 0,  // 壁走り可能
+};
+ENUM_CLASS_FLAGS(EWallRunSurfaceFlags);
+
+/**
+ * @brief 焼き込み済みの壁面1枚（平面上の矩形）
+ */
+USTRUCT()
+struct FWallRunSurface
+{
+    GENERATED_BODY()
+
+    /** 矩形の中心 */
+    UPROPERTY()
+    FVector Center = FVector::ZeroVector;
+
+    /** 面の法線（外向き） */
+    UPROPERTY()
+    FVector3f Normal = FVector3f::ZeroVector;
+
+    /** 面内の水平方向（Tangent）と、それに直交する方向の半径 */
+    UPROPERTY()
+    FVector2f HalfExtent = FVector2f::ZeroVector;
+
+    /** 元になったアクター（SourceActors のインデックス） */
+    UPROPERTY()
+    int32 ActorIndex = INDEX_NONE;
+
+    /** 元になったコンポーネント（SourceComponents のインデックス） */
+    UPROPERTY()
+    int32 ComponentIndex = INDEX_NONE;
+
+    /** EWallRunSurfaceFlags */
+    UPROPERTY()
+    uint8 Flags = 0;
+
+    /** @brief 面内の水平方向 */
+    FVector GetTangent() const;
+
+    /** @brief 面内の Tangent に直交する方向（ほぼ上向き） */
+    FVector GetBitangent() const;
+};
+
+/**
+ * @brief 壁面インデックスへの問い合わせ結果
+ */
+struct FWallRunSurfaceHit
+{
+    /** 壁面のインデックス */
+    int32 SurfaceIndex = INDEX_NONE;
+
+    /** 問い合わせ位置から面までの距離 */
+    float Distance = 0.0f;
+
+    /** 面上の最近接点 */
+    FVector ImpactPoint = FVector::ZeroVector;
+
+    /** 面の法線 */
+    FVector Normal = FVector::ZeroVector;
+};
+
+/**
+ * @brief 壁走り可能な面を焼き込んだ空間インデックス
+ *
+ * エディタで AWallRunSurfaceBakeVolume から生成する。
+ * 面は FTraversalCellGrid（XY平面の一様グリッド）に登録する。
+ * 実行時はトレースせず、近傍セルの面との距離計算だけで壁を探す。
+ */
+UCLASS(BlueprintType)
+class CARRY_API UWallRunSurfaceIndex : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief 位置の周囲にある面を列挙
+     * @param Location 問い合わせ位置
+     * @param MaxDistance 面までの最大距離
+     * @param Visitor 面ごとに呼ばれる（面, 距離, 最近接点）
+     */
+    void ForEachSurfaceNear(const FVector& Location, float MaxDistance,
+        TFunctionRef<void(int32 SurfaceIndex, const FWallRunSurface& Surface, float Distance, const FVector& ImpactPoint)> Visitor) const;
+
+    /**
+     * @brief 位置が焼き込み範囲内か（範囲外は実行時トレースで補う）
+     */
+    bool ContainsLocation(const FVector& Location) const { return Grid.ContainsLocation(Location); }
+
+    /**
+     * @brief 面が位置からまだ到達可能か
+     * @param SurfaceIndex 面のインデックス
+     * @param Location 問い合わせ位置
+     * @param MaxDistance 面までの最大距離
+     */
+    bool IsSurfaceInReach(int32 SurfaceIndex, const FVector& Location, float MaxDistance) const;
+
+    /** @brief 面を取得 */
+    const FWallRunSurface& GetSurface(int32 SurfaceIndex) const { return Surfaces[SurfaceIndex]; }
+
+    /** @brief 面の元アクター（未ロードなら nullptr） */
+    AActor* GetSurfaceActor(int32 SurfaceIndex) const;
+
+    /** @brief 面の元コンポーネント（未ロードなら nullptr） */
+    UPrimitiveComponent* GetSurfaceComponent(int32 SurfaceIndex) const;
+
+    /** @brief 面の数 */
+    int32 GetSurfaceCount() const { return Surfaces.Num(); }
+
+#if WITH_EDITOR
+    /**
+     * @brief 焼き込み結果を設定してグリッドを構築（エディタ専用）
+     */
+    void Build(TArray<FWallRunSurface>&& InSurfaces, TArray<TSoftObjectPtr<AActor>>&& InSourceActors,
+        TArray<TSoftObjectPtr<UPrimitiveComponent>>&& InSourceComponents, const FBox& InBounds, float InCellSize);
+#endif
+
+private:
+    /**
+     * @brief 面との距離・最近接点を計算
+     * @return 面の表側かつ矩形内で MaxDistance 以内なら true
+     */
+    bool ProjectOntoSurface(const FWallRunSurface& Surface, const FVector& Location, float MaxDistance,
+        float& OutDistance, FVector& OutImpactPoint) const;
+
+private:
+    /** 焼き込んだ面 */
+    UPROPERTY(VisibleAnywhere, Category = "Wall Run")
+    TArray<FWallRunSurface> Surfaces;
+
+    /** 面の元アクター */
+    UPROPERTY(VisibleAnywhere, Category = "Wall Run")
+    TArray<TSoftObjectPtr<AActor>> SourceActors;
+
+    /** 面の元コンポーネント */
+    UPROPERTY(VisibleAnywhere, Category = "Wall Run")
+    TArray<TSoftObjectPtr<UPrimitiveComponent>> SourceComponents;
+
+    /** 面の空間インデックス */
+    UPROPERTY(VisibleAnywhere, Category = "Wall Run")
+    FTraversalCellGrid Grid;
+};
@@ -2,8 +2,13 @@
 
 
 #include "Component/WallRun/WallDetectionComponent.h"
+#include "Object/WallRun/WallRunSurfaceIndex.h"
+#include "Object/WallRun/WallRunSurfaceBakeVolume.h"
+#include "SubSystem/TraversalSurfaceSubsystem.h"
+#include "EngineUtils.h"
 #include "Components/BoxComponent.h"
 #include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
 #include "DrawDebugHelpers.h"
 
 UWallDetectionComponent::UWallDetectionComponent()
@@ -14,9 +19,25 @@ UWallDetectionComponent::UWallDetectionComponent()
     PrimaryComponentTick.bCanEverTick = true;
 }
 
+// 処理の流れ:
+// 1. スケジューラを取得
+// 2. レベル内の焼き込み範囲からインデックスを一度だけ収集
+// 3. 面の性質のサブシステムを取得
 void UWallDetectionComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    TraceScheduler = GetWorld()->GetSubsystem<UTraceSchedulerSubsystem>();
+    TraversalSurfaces = GetWorld()->GetSubsystem<UTraversalSurfaceSubsystem>();
+
+    for (TActorIterator<AWallRunSurfaceBakeVolume> It(GetWorld()); It; ++It)
+    {
+        UWallRunSurfaceIndex* Index = It->GetSurfaceIndex();
+        if (Index && Index->GetSurfaceCount() > 0)
+        {
+            SurfaceIndices.AddUnique(Index);
+        }
+    }
 }
 
 void UWallDetectionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -28,6 +49,12 @@ void UWallDetectionComponent::TickComponent(float DeltaTime, ELevelTick TickType
         return;
     }
 
+    // 接触待ちの壁は間隔に関係なく毎フレーム進める
+    if (bHasPendingWall)
+    {
+        UpdatePendingWall(DeltaTime);
+    }
+
     // 検出間隔の制御
     DetectionTimer += DeltaTime;
     if (DetectionTimer >= Settings.DetectionInterval)
@@ -41,25 +68,93 @@ void UWallDetectionComponent::TickComponent(float DeltaTime, ELevelTick TickType
 // Detection
 // ============================================
 
+// 処理の流れ:
+// 1. スケジューラの結果待ちなら何もしない
+// 2. 壁未検出なら焼き込み済みインデックスを先に引く
+//    - 見つかればトレースせずに反映
+//    - 焼き込み範囲内なら、以降のトレースは可動物のみ対象にする
+// 3. 予測が有効なら速度方向の経路を探し、見つかれば接触待ちにする
+// 4. 壁未検出かつ ShapeSweep なら球Sweep1回で最良の壁を探す
+// 5. 壁未検出かつ RayFan なら前方・左右前方へレイを飛ばす
+//    - プレイヤー（Urgent）はその場で実行して結果を反映
+//    - それ以外はスケジューラに預け、3本揃ったら反映
+// 6. 壁検出中なら壁がまだ存在するか確認（焼き込み済みの面は距離計算のみ）
 void UWallDetectionComponent::DetectWall()
 {
     AActor* Owner = GetOwner();
-    if (!Owner)
+    if (!Owner || bTracePending || bHasPendingWall)
+    {
+        return;
+    }
+
+    if (!bIsWallDetected && SurfaceIndices.Num() > 0)
+    {
+        FHitResult BakedHit;
+        bool bInsideBakedArea = false;
+        if (FindBakedWall(BakedHit, bInsideBakedArea))
+        {
+            return;
+        }
+
+        bTraceDynamicOnly = bInsideBakedArea;
+    }
+
+    if (!bIsWallDetected && Settings.bPredictFromVelocity && PredictWallContact())
     {
         return;
     }
-    if (!bIsWallDetected)
+
+    if (bIsWallDetected && CurrentSurfaceIndex)
+    {
+        if (!CurrentSurfaceIndex->IsSurfaceInReach(CurrentSurfaceId, Owner->GetActorLocation(), Settings.BakedWallLossDistance))
+        {
+            // 壁を失った
+            LoseCurrentWall();
+            UE_LOG(LogTemp, Log, TEXT("WallDetection: Wall lost"));
+        }
+    }
+    else if (!bIsWallDetected && Settings.DetectionMode == EWallDetectionMode::ShapeSweep)
+    {
+        // 予算切れなら次回に回す
+        if (TraceScheduler.IsValid() && !TraceScheduler->TryConsumeBudget(GetTracePriority()))
+        {
+            return;
+        }
+
+        FHitResult BestHit;
+        const bool bFoundWall = SweepForBestWall(BestHit);
+        ApplyDetectionResult(bFoundWall, BestHit);
+    }
+    else if (!bIsWallDetected)
     {
         // キャラクターの前方向を取得
-        FVector ForwardDirection = Owner->GetActorForwardVector();
+        const FVector ForwardDirection = Owner->GetActorForwardVector();
 
         // 左右にもレイキャストを飛ばす
-        TArray<FVector> Directions = {
+        const FVector Directions[FanRayCount] = {
             ForwardDirection,                                           // 前
             ForwardDirection.RotateAngleAxis(45.0f, FVector::UpVector),  // 右前
             ForwardDirection.RotateAngleAxis(-45.0f, FVector::UpVector)  // 左前
         };
 
+        if (ShouldDeferTraces())
+        {
+            const FVector Start = Owner->GetActorLocation();
+
+            bTracePending = true;
+            PendingFanRays = FanRayCount;
+
+            for (int32 Index = 0; Index < FanRayCount; ++Index)
+            {
+                bFanHitValid[Index] = false;
+
+                FTraceRequest Request = MakeRayRequest(Start, Start + Directions[Index] * Settings.DetectionDistance);
+                Request.OnCompleted = FOnTraceCompleted::CreateUObject(this, &UWallDetectionComponent::HandleFanTraceCompleted, Index);
+                TraceScheduler->Submit(MoveTemp(Request));
+            }
+            return;
+        }
+
         FHitResult BestHit;
         bool bFoundWall = false;
 
@@ -84,42 +179,170 @@ void UWallDetectionComponent::DetectWall()
             //}
         }
 
-        // 壁の検出状態が変化したかチェック
-        if (bFoundWall)
+        ApplyDetectionResult(bFoundWall, BestHit);
+    }
+    else
+    {
+        if (ShouldDeferTraces() && !CurrentWallNormal.IsNearlyZero())
         {
-            AActor* HitActor = BestHit.GetActor();
+            const FVector Start = Owner->GetActorLocation();
 
-            if (!bIsWallDetected || CurrentWall != HitActor)
-            {
-                // 新しい壁を検出
-                bIsWallDetected = true;
-                CurrentWall = HitActor;
-                LastHitResult = BestHit;
+            bTracePending = true;
 
-                OnWallDetected.Broadcast(HitActor, BestHit);
-                UE_LOG(LogTemp, Log, TEXT("WallDetection: Wall detected - %s"), *HitActor->GetName());
-            }
-            else
-            {
-                // 既存の壁を更新
-                LastHitResult = BestHit;
-            }
+            FTraceRequest Request = MakeRayRequest(Start, Start + CurrentWallNormal * 150.0f);
+            Request.OnCompleted = FOnTraceCompleted::CreateUObject(this, &UWallDetectionComponent::HandleWallCheckCompleted);
+            TraceScheduler->Submit(MoveTemp(Request));
+            return;
         }
+
+        if (!CheckWallStillExists(Owner->GetActorLocation()))
+        {
+            // 壁を失った
+            LoseCurrentWall();
+            UE_LOG(LogTemp, Log, TEXT("WallDetection: Wall lost"));
+        }
+    }
+}
+
+// 処理の流れ:
+// 1. 壁が見つからなければ何もしない
+// 2. 新しい壁ならイベントを発行、同じ壁ならヒット情報のみ更新
+void UWallDetectionComponent::ApplyDetectionResult(bool bFoundWall, const FHitResult& BestHit)
+{
+    // 壁の検出状態が変化したかチェック
+    if (!bFoundWall)
+    {
+        return;
+    }
+
+    AActor* HitActor = BestHit.GetActor();
+
+    if (!bIsWallDetected || CurrentWall != HitActor)
+    {
+        // 新しい壁を検出
+        bIsWallDetected = true;
+        CurrentWall = HitActor;
+        LastHitResult = BestHit;
+
+        OnWallDetected.Broadcast(HitActor, BestHit);
+        UE_LOG(LogTemp, Log, TEXT("WallDetection: Wall detected - %s"), *GetNameSafe(HitActor));
     }
     else
     {
-        if (!CheckWallStillExists(GetOwner()->GetActorLocation()))
-        {
-            // 壁を失った
-            AActor* LostWall = CurrentWall.Get();
-            bIsWallDetected = false;
-            CurrentWall = nullptr;
+        // 既存の壁を更新
+        LastHitResult = BestHit;
+    }
+}
 
-            OnWallLost.Broadcast(LostWall);
-            UE_LOG(LogTemp, Log, TEXT("WallDetection: Wall lost"));
+void UWallDetectionComponent::LoseCurrentWall()
+{
+    AActor* LostWall = CurrentWall.Get();
+    bIsWallDetected = false;
+    CurrentWall = nullptr;
+    CurrentSurfaceIndex = nullptr;
+    CurrentSurfaceId = INDEX_NONE;
+
+    OnWallLost.Broadcast(LostWall);
+}
+
+// ============================================
+// Trace Scheduling
+// ============================================
+
+// 処理の流れ:
+// 1. プレイヤー操作中のポーンは常にUrgent
+// 2. それ以外は設定値
+ETracePriority UWallDetectionComponent::GetTracePriority() const
+{
+    const APawn* Pawn = Cast<APawn>(GetOwner());
+    if (Pawn && Pawn->IsPlayerControlled())
+    {
+        return ETracePriority::Urgent;
+    }
+
+    return Settings.TracePriority;
+}
+
+bool UWallDetectionComponent::ShouldDeferTraces() const
+{
+    return TraceScheduler.IsValid() && GetTracePriority() != ETracePriority::Urgent;
+}
+
+FTraceRequest UWallDetectionComponent::MakeRayRequest(const FVector& Start, const FVector& End) const
+{
+    FTraceRequest Request;
+    Request.Start = Start;
+    Request.End = End;
+    Request.Channel = ECC_Visibility;
+    Request.Params.AddIgnoredActor(GetOwner());
+    Request.Params.MobilityType = bTraceDynamicOnly ? EQueryMobilityType::Dynamic : EQueryMobilityType::Any;
+    // 面の性質をヒット位置の物理マテリアル（ランドスケープのレイヤー等）からも取る
+    Request.Params.bReturnPhysicalMaterial = true;
+    Request.Priority = GetTracePriority();
+    Request.Requester = this;
+    return Request;
+}
+
+// 処理の流れ:
+// 1. ヒットした面の性質をキャッシュから取得（アクターの無いBSP・ランドスケープも可）
+// 2. 壁走り禁止なら除外
+bool UWallDetectionComponent::FilterRayHit(bool bHit, const FHitResult& Hit) const
+{
+    if (!bHit)
+    {
+        return false;
+    }
+
+    const ETraversalFlags Flags = TraversalSurfaces.IsValid()
+        ? TraversalSurfaces->GetFlags(Hit)
+        : UTraversalSurfaceSubsystem::GetFlagsForHit(GetWorld(), Hit);
+
+    return !EnumHasAnyFlags(Flags, ETraversalFlags::NoWallRun);
+}
+
+// 処理の流れ:
+// 1. 結果を保存
+// 2. 3本揃ったら、前→右前→左前の順で最初の有効な壁を採用
+void UWallDetectionComponent::HandleFanTraceCompleted(bool bHit, const FHitResult& Hit, int32 Index)
+{
+    FanHits[Index] = Hit;
+    bFanHitValid[Index] = FilterRayHit(bHit, Hit);
+
+    if (--PendingFanRays > 0)
+    {
+        return;
+    }
+
+    bTracePending = false;
+
+    if (!bDetectionEnabled || bIsWallDetected)
+    {
+        return;
+    }
+
+    for (int32 RayIndex = 0; RayIndex < FanRayCount; ++RayIndex)
+    {
+        if (bFanHitValid[RayIndex] && IsValidWall(FanHits[RayIndex]))
+        {
+            ApplyDetectionResult(true, FanHits[RayIndex]);
+            return;
         }
     }
-   
+}
+
+// 処理の流れ:
+// 1. 壁が無ければ見失ったとしてイベントを発行
+void UWallDetectionComponent::HandleWallCheckCompleted(bool bHit, const FHitResult& Hit)
+{
+    bTracePending = false;
+
+    if (!bDetectionEnabled || !bIsWallDetected || bHit)
+    {
+        return;
+    }
+
+    LoseCurrentWall();
+    UE_LOG(LogTemp, Log, TEXT("WallDetection: Wall lost"));
 }
 
 bool UWallDetectionComponent::IsValidWall(const FHitResult& Hit) const
@@ -129,14 +352,18 @@ bool UWallDetectionComponent::IsValidWall(const FHitResult& Hit) const
         return false;
     }
 
+    float ApproachAngle = 0.0f;
+    return EvaluateWallNormal(Hit.ImpactNormal, ApproachAngle);
+}
+
+bool UWallDetectionComponent::EvaluateWallNormal(const FVector& Normal, float& OutApproachAngle) const
+{
     AActor* Owner = GetOwner();
     if (!Owner)
     {
         return false;
     }
 
-    FVector Normal = Hit.ImpactNormal;
-
     // 壁の角度をチェック（垂直に近い面のみ）
     float VerticalAngle = FMath::Acos(FVector::DotProduct(Normal, FVector::UpVector)) * 180.0f / PI;
     if (VerticalAngle < Settings.MinWallAngle)
@@ -153,6 +380,7 @@ bool UWallDetectionComponent::IsValidWall(const FHitResult& Hit) const
     // 内積から角度を計算（-1.0 ～ 1.0 の範囲）
     // -1.0 = 180度（真逆）、0.0 = 90度（直角）、1.0 = 0度（同じ向き）
     float AngleDegrees = FMath::Acos(FMath::Clamp(DotProduct, -1.0f, 1.0f)) * 180.0f / PI;
+    OutApproachAngle = AngleDegrees;
 
     // 壁に対して正面から接触している場合は無効（壁走り不可）
     // 斜めから接触している場合のみ有効（壁走り可能）
@@ -170,35 +398,316 @@ bool UWallDetectionComponent::IsValidWall(const FHitResult& Hit) const
     //UE_LOG(LogTemp, VeryVerbose, TEXT("WallDetection: Valid wall detected at angle: %.2f degrees"), AngleDegrees);
     return true;
 }
-bool UWallDetectionComponent::PerformRayCast(const FVector& Direction, FHitResult& OutHit) const
+
+// 処理の流れ:
+// 1. 前方へ球をSweepし、ブロックも含めて全ヒットを候補として集める
+// 2. 開始時点で食い込んでいる候補は押し出し方向(MTD)から法線と接触点を補う
+//    （球が既に壁に触れている場合も検出できるように）
+//    壁走り禁止の面は除外
+// 3. 接近角が有効な候補を、距離 + 理想角からのずれ でスコアリング
+// 4. 最小スコアの候補を返す
+bool UWallDetectionComponent::SweepForBestWall(FHitResult& OutBestHit)
 {
     AActor* Owner = GetOwner();
-    if (!Owner)
+    UWorld* World = GetWorld();
+    if (!Owner || !World)
     {
         return false;
     }
 
-    FVector Start = GetOwner()->GetActorLocation();
-    FVector End = Start + Direction * Settings.DetectionDistance;
+    const FVector Start = Owner->GetActorLocation();
+    const FVector End = Start + Owner->GetActorForwardVector() * Settings.DetectionDistance;
 
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(Owner);
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(WallDetectionSweep), false, Owner);
+    Params.MobilityType = bTraceDynamicOnly ? EQueryMobilityType::Dynamic : EQueryMobilityType::Any;
+    Params.bReturnPhysicalMaterial = true;
 
+    // 最初のブロックで止まらないよう、全てオーバーラップ扱いで候補を集める
+    FCollisionResponseParams ResponseParams;
+    ResponseParams.CollisionResponse.SetAllChannels(ECR_Overlap);
 
-    bool bHit = GetWorld()->LineTraceSingleByChannel(
-        OutHit,
+    SweepHits.Reset();
+    World->SweepMultiByChannel(
+        SweepHits,
         Start,
         End,
+        FQuat::Identity,
         ECC_Visibility,
-        Params
+        FCollisionShape::MakeSphere(Settings.SweepRadius),
+        Params,
+        ResponseParams
     );
 
-    if (bHit && OutHit.GetActor()->ActorHasTag("NoWallRun"))
+    const FHitResult* BestHit = nullptr;
+    float BestScore = TNumericLimits<float>::Max();
+
+    for (FHitResult& Hit : SweepHits)
     {
-        bHit = false;
+        if (!FilterRayHit(true, Hit))
+        {
+            continue;
+        }
+
+        if (Hit.bStartPenetrating)
+        {
+            // 押し出し方向が求まらなかった食い込みは判定できない
+            if (Hit.Normal.IsNearlyZero())
+            {
+                continue;
+            }
+
+            // 開始位置で食い込んでいる場合、Normal は押し出し方向（壁の外向き）になる
+            Hit.ImpactNormal = Hit.Normal;
+            Hit.ImpactPoint = Start - Hit.Normal * FMath::Max(0.0f, Settings.SweepRadius - Hit.PenetrationDepth);
+            Hit.Distance = 0.0f;
+            Hit.Time = 0.0f;
+        }
+
+        float ApproachAngle = 0.0f;
+        if (!EvaluateWallNormal(Hit.ImpactNormal, ApproachAngle))
+        {
+            continue;
+        }
+
+        const float AngleError = FMath::Abs(ApproachAngle - Settings.IdealApproachAngle) / 90.0f;
+        const float Score = Hit.Time + Settings.ApproachAngleWeight * AngleError;
+
+        if (Score < BestScore)
+        {
+            BestScore = Score;
+            BestHit = &Hit;
+        }
+    }
+
+    if (!BestHit)
+    {
+        return false;
     }
 
-    return bHit;
+    OutBestHit = *BestHit;
+    OutBestHit.bBlockingHit = true;
+    return true;
+}
+
+// 処理の流れ:
+// 1. 現在位置を含むインデックスから、検出距離内の面を列挙
+// 2. 壁走り可能で接近角が有効な面を、距離 + 理想角からのずれ でスコアリング
+// 3. 最良の面からヒット情報を組み立てて反映し、面を覚えておく
+bool UWallDetectionComponent::FindBakedWall(FHitResult& OutBestHit, bool& bOutInsideBakedArea)
+{
+    bOutInsideBakedArea = false;
+
+    AActor* Owner = GetOwner();
+    if (!Owner)
+    {
+        return false;
+    }
+
+    const FVector Location = Owner->GetActorLocation();
+
+    UWallRunSurfaceIndex* BestIndex = nullptr;
+    int32 BestSurface = INDEX_NONE;
+    FVector BestImpactPoint = FVector::ZeroVector;
+    float BestDistance = 0.0f;
+    float BestScore = TNumericLimits<float>::Max();
+
+    for (UWallRunSurfaceIndex* Index : SurfaceIndices)
+    {
+        if (!Index || !Index->ContainsLocation(Location))
+        {
+            continue;
+        }
+
+        bOutInsideBakedArea = true;
+
+        Index->ForEachSurfaceNear(Location, Settings.DetectionDistance,
+            [&](int32 SurfaceIndex, const FWallRunSurface& Surface, float Distance, const FVector& ImpactPoint)
+            {
+                if (!(Surface.Flags & static_cast<uint8>(EWallRunSurfaceFlags::Runnable)))
+                {
+                    return;
+                }
+
+                float ApproachAngle = 0.0f;
+                if (!EvaluateWallNormal(FVector(Surface.Normal), ApproachAngle))
+                {
+                    return;
+                }
+
+                const float AngleError = FMath::Abs(ApproachAngle - Settings.IdealApproachAngle) / 90.0f;
+                const float Score = Distance / Settings.DetectionDistance + Settings.ApproachAngleWeight * AngleError;
+
+                if (Score < BestScore)
+                {
+                    BestScore = Score;
+                    BestIndex = Index;
+                    BestSurface = SurfaceIndex;
+                    BestImpactPoint = ImpactPoint;
+                    BestDistance = Distance;
+                }
+            });
+    }
+
+    if (!BestIndex)
+    {
+        return false;
+    }
+
+    OutBestHit = MakeBakedHit(*BestIndex, BestSurface, Location, BestImpactPoint, BestDistance);
+    ApplyDetectionResult(true, OutBestHit);
+
+    CurrentSurfaceIndex = BestIndex;
+    CurrentSurfaceId = BestSurface;
+    return true;
+}
+
+FHitResult UWallDetectionComponent::MakeBakedHit(const UWallRunSurfaceIndex& Index, int32 SurfaceIndex,
+    const FVector& TraceStart, const FVector& ImpactPoint, float Distance) const
+{
+    const FVector Normal(Index.GetSurface(SurfaceIndex).Normal);
+
+    FHitResult Hit;
+    Hit.bBlockingHit = true;
+    Hit.TraceStart = TraceStart;
+    Hit.TraceEnd = ImpactPoint;
+    Hit.Location = ImpactPoint;
+    Hit.ImpactPoint = ImpactPoint;
+    Hit.Normal = Normal;
+    Hit.ImpactNormal = Normal;
+    Hit.Distance = Distance;
+    Hit.Time = Distance / Settings.DetectionDistance;
+
+    if (AActor* SurfaceActor = Index.GetSurfaceActor(SurfaceIndex))
+    {
+        Hit.HitObjectHandle = FActorInstanceHandle(SurfaceActor);
+    }
+
+    // 焼き込んだ面のコンポーネント（物理マテリアルやタグの判定に使われる）
+    Hit.Component = Index.GetSurfaceComponent(SurfaceIndex);
+
+    return Hit;
+}
+
+// 処理の流れ:
+// 1. 水平速度が足りなければ予測しない
+// 2. 次の検出までに進む距離 + 検出距離 だけ、速度方向へ球をSweep
+//    （トレース予算が残っていなければ予測しない）
+// 3. 有効な壁なら接触までの時間を求める
+//    - 次のフレームまでに接触するなら、その場で検出として確定
+//    - それ以外は接触待ちにして OnWallPending を発行
+bool UWallDetectionComponent::PredictWallContact()
+{
+    AActor* Owner = GetOwner();
+    UWorld* World = GetWorld();
+    if (!Owner || !World)
+    {
+        return false;
+    }
+
+    FVector Velocity = Owner->GetVelocity();
+    Velocity.Z = 0.0f;
+
+    const float Speed = Velocity.Size();
+    if (Speed < Settings.MinPredictionSpeed)
+    {
+        return false;
+    }
+
+    const FVector Direction = Velocity / Speed;
+    const FVector Start = Owner->GetActorLocation();
+    const float PathLength = Speed * Settings.DetectionInterval + Settings.DetectionDistance;
+
+    FTraceRequest Request = MakeRayRequest(Start, Start + Direction * PathLength);
+    Request.Shape = FCollisionShape::MakeSphere(Settings.PredictionRadius);
+
+    FHitResult Hit;
+    bool bHit = false;
+    if (TraceScheduler.IsValid())
+    {
+        // 予算切れなら予測は諦め、通常の検出に任せる
+        if (!TraceScheduler->TryExecuteImmediate(Request, Hit, bHit))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        bHit = World->SweepSingleByChannel(Hit, Request.Start, Request.End, FQuat::Identity, Request.Channel, Request.Shape, Request.Params);
+    }
+
+    if (!FilterRayHit(bHit, Hit) || Hit.bStartPenetrating || !IsValidWall(Hit))
+    {
+        return false;
+    }
+
+    // 検出距離まで近づいた時点を接触とみなす
+    const float DistanceToContact = FMath::Max(0.0f, Hit.Distance - Settings.DetectionDistance);
+    const float TimeToContact = DistanceToContact / Speed;
+
+    if (TimeToContact <= World->GetDeltaSeconds())
+    {
+        ApplyDetectionResult(true, Hit);
+        return true;
+    }
+
+    PendingWallHit = Hit;
+    PendingTimeToContact = TimeToContact;
+    bHasPendingWall = true;
+
+    OnWallPending.Broadcast(Hit.GetActor(), Hit, TimeToContact);
+    UE_LOG(LogTemp, Verbose, TEXT("WallDetection: Wall pending - %s in %.3fs"), *GetNameSafe(Hit.GetActor()), TimeToContact);
+    return true;
+}
+
+// 処理の流れ:
+// 1. 残り時間を進め、接触フレームまで待つ
+// 2. 接触フレームで、予測した面がまだ検出距離内にあるか確認（トレースなし）
+// 3. 進路が変わって面から離れていれば破棄、そうでなければ検出として確定
+void UWallDetectionComponent::UpdatePendingWall(float DeltaTime)
+{
+    PendingTimeToContact -= DeltaTime;
+    if (PendingTimeToContact > DeltaTime)
+    {
+        return;
+    }
+
+    const AActor* Owner = GetOwner();
+    const FHitResult Hit = PendingWallHit;
+    ClearPendingWall();
+
+    if (!Owner || bIsWallDetected)
+    {
+        return;
+    }
+
+    const float PlaneDistance = FVector::DotProduct(Owner->GetActorLocation() - Hit.ImpactPoint, Hit.ImpactNormal);
+    if (PlaneDistance < 0.0f || PlaneDistance > Settings.DetectionDistance || !IsValidWall(Hit))
+    {
+        return;
+    }
+
+    ApplyDetectionResult(true, Hit);
+}
+
+bool UWallDetectionComponent::PerformRayCast(const FVector& Direction, FHitResult& OutHit) const
+{
+    AActor* Owner = GetOwner();
+    if (!Owner)
+    {
+        return false;
+    }
+
+    FVector Start = GetOwner()->GetActorLocation();
+    FVector End = Start + Direction * Settings.DetectionDistance;
+
+    const FTraceRequest Request = MakeRayRequest(Start, End);
+
+    // スケジューラがあれば予算にカウントさせる
+    const bool bHit = TraceScheduler.IsValid()
+        ? TraceScheduler->ExecuteImmediate(Request, OutHit)
+        : GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, ECC_Visibility, Request.Params);
+
+    return FilterRayHit(bHit, OutHit);
 }
 
 void UWallDetectionComponent::DrawDebug(const FVector& Direction, bool bHit, const FHitResult& Hit) const
@@ -225,13 +734,26 @@ void UWallDetectionComponent::SetDetectionEnabled(bool bEnabled)
 {
     bDetectionEnabled = bEnabled;
 
+    if (!bEnabled)
+    {
+        ClearPendingWall();
+    }
+
+    if (!bEnabled && bTracePending)
+    {
+        // 待機中の要求は不要になる
+        if (TraceScheduler.IsValid())
+        {
+            TraceScheduler->CancelRequests(this);
+        }
+        bTracePending = false;
+        PendingFanRays = 0;
+    }
+
     if (!bEnabled && bIsWallDetected)
     {
         // 検出を無効化したら現在の壁を失う
-        AActor* LostWall = CurrentWall.Get();
-        bIsWallDetected = false;
-        CurrentWall = nullptr;
-        OnWallLost.Broadcast(LostWall);
+        LoseCurrentWall();
     }
 }
 
@@ -253,17 +775,12 @@ bool UWallDetectionComponent::CheckWallStillExists(const FVector& CharacterLocat
     FVector EndLocation = StartLocation + (CurrentWallNormal * TraceDistance);
 
     FHitResult HitResult;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(GetOwner());
-
-    // レイキャスト実行
-    bool bHit = World->LineTraceSingleByChannel(
-        HitResult,
-        StartLocation,
-        EndLocation,
-        ECC_Visibility,
-        QueryParams
-    );
+    const FTraceRequest Request = MakeRayRequest(StartLocation, EndLocation);
+
+    // レイキャスト実行（スケジューラがあれば予算にカウントさせる）
+    bool bHit = TraceScheduler.IsValid()
+        ? TraceScheduler->ExecuteImmediate(Request, HitResult)
+        : World->LineTraceSingleByChannel(HitResult, StartLocation, EndLocation, ECC_Visibility, Request.Params);
 
 //    // デバッグ描画
 //#if ENABLE_DRAW_DEBUG
@@ -4,8 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "Components/SceneComponent.h"
+#include "SubSystem/TraceSchedulerSubsystem.h"
 #include "WallDetectionComponent.generated.h"
 
+class UWallRunSurfaceIndex;
+class UTraversalSurfaceSubsystem;
+
 // ============================================================
 // デリゲート宣言
 // ============================================================
@@ -23,6 +27,32 @@ DECLARE_MULTICAST_DELEGATE_TwoParams(FOnWallDetected, AActor*, const FHitResult&
  */
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnWallLost, AActor*);
 
+/**
+ * @brief 速度から壁への接触が予測された際に呼び出されるイベント
+ * @param AActor* 接触予定の壁のアクター
+ * @param FHitResult& 予測経路上のヒット情報
+ * @param float 接触までの予測時間（秒）
+ * @details 接触時刻に達すると OnWallDetected が発行される
+ */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnWallPending, AActor*, const FHitResult&, float);
+
+
+// ============================================================
+// 壁検出方式
+// ============================================================
+
+/**
+ * @brief 壁の検出方式
+ */
+UENUM(BlueprintType)
+enum class EWallDetectionMode : uint8
+{
+    /** 前・右前・左前の3本のレイ。最初に見つかった有効な壁を使う */
+    RayFan      UMETA(DisplayName = "Ray Fan"),
+
+    /** 球の前方Sweep1回で候補を集め、接近角と距離で最良の壁を選ぶ */
+    ShapeSweep  UMETA(DisplayName = "Shape Sweep"),
+};
 
 // ============================================================
 // 壁検出設定構造体
@@ -40,6 +70,10 @@ struct FWallDetectionSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detection", meta = (ClampMin = "10.0", ClampMax = "200.0"))
     float DetectionDistance = 100.0f;
 
+    /** 焼き込み済みの壁を見失ったとみなす、面までの距離（検出距離より長くして検出と喪失を繰り返さないようにする） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detection", meta = (ClampMin = "10.0", ClampMax = "400.0"))
+    float BakedWallLossDistance = 150.0f;
+
     /** 検出の更新間隔（秒単位） */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detection", meta = (ClampMin = "0.01", ClampMax = "1.0"))
     float DetectionInterval = 0.1f;
@@ -63,6 +97,43 @@ struct FWallDetectionSettings
         meta = (ClampMin = "90.0", ClampMax = "180.0",
             ToolTip = "この角度より大きい場合、正面すぎて壁走り不可（デフォルト150度）"))
     float MaxValidAngle = 150.0f;
+
+    /** 検出方式 */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detection")
+    EWallDetectionMode DetectionMode = EWallDetectionMode::RayFan;
+
+    /** ShapeSweep で使う球の半径。開始時点で食い込んだ壁は押し出し方向から法線を求めて候補にする */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detection|Shape Sweep",
+        meta = (ClampMin = "1.0", ClampMax = "200.0", EditCondition = "DetectionMode == EWallDetectionMode::ShapeSweep"))
+    float SweepRadius = 60.0f;
+
+    /** ShapeSweep で最も好ましい接近角（度）。90 = 壁と平行、180 = 正面 */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detection|Shape Sweep",
+        meta = (ClampMin = "0.0", ClampMax = "180.0", EditCondition = "DetectionMode == EWallDetectionMode::ShapeSweep"))
+    float IdealApproachAngle = 120.0f;
+
+    /** ShapeSweep のスコアで、距離に対する角度のずれの重み */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detection|Shape Sweep",
+        meta = (ClampMin = "0.0", EditCondition = "DetectionMode == EWallDetectionMode::ShapeSweep"))
+    float ApproachAngleWeight = 1.0f;
+
+    /** 速度から次の検出までの移動経路を予測して壁を探すか */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detection|Prediction")
+    bool bPredictFromVelocity = false;
+
+    /** 予測に使う最低水平速度（これ未満は通常の検出のみ） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detection|Prediction",
+        meta = (ClampMin = "0.0", EditCondition = "bPredictFromVelocity"))
+    float MinPredictionSpeed = 600.0f;
+
+    /** 予測経路をなぞる球の半径 */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detection|Prediction",
+        meta = (ClampMin = "1.0", ClampMax = "200.0", EditCondition = "bPredictFromVelocity"))
+    float PredictionRadius = 40.0f;
+
+    /** プレイヤー操作でない場合のトレース優先度（プレイヤーは常にUrgent） */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Detection|Scheduling")
+    ETracePriority TracePriority = ETracePriority::Normal;
 };
 
 
@@ -127,6 +198,11 @@ public:
     UFUNCTION(BlueprintPure, Category = "Wall Detection")
     AActor* GetDetectedWall() const { return CurrentWall.Get(); }
 
+    /**
+     * @brief 検出設定を取得
+     */
+    const FWallDetectionSettings& GetSettings() const { return Settings; }
+
     /**
      * @brief 最後に検出したヒット情報を取得
      * @return 壁との最後のヒット結果
@@ -159,6 +235,9 @@ public:
     /** 壁を見失った際に発火するイベント */
     FOnWallLost OnWallLost;
 
+    /** 速度から壁への接触を予測した際に発火するイベント */
+    FOnWallPending OnWallPending;
+
 
 private:
     // ============================================================
@@ -179,6 +258,48 @@ private:
      */
     bool IsValidWall(const FHitResult& Hit) const;
 
+    /**
+     * @brief 法線が壁として有効か判定し、接近角を求める
+     * @param Normal 面の法線
+     * @param OutApproachAngle キャラクター前方と法線のなす角（度）
+     * @return 壁と認識できる場合 true
+     */
+    bool EvaluateWallNormal(const FVector& Normal, float& OutApproachAngle) const;
+
+    /**
+     * @brief 球Sweep1回で候補を集め、最良の壁を選ぶ
+     * @param OutBestHit 選ばれた壁のヒット情報
+     * @return 有効な壁が見つかった場合 true
+     */
+    bool SweepForBestWall(FHitResult& OutBestHit);
+
+    /**
+     * @brief 焼き込み済みインデックスから最良の壁を探す（トレースなし）
+     * @param OutBestHit 選ばれた壁から組み立てたヒット情報
+     * @param bOutInsideBakedArea 現在位置が焼き込み範囲内か
+     * @return 有効な壁が見つかった場合 true
+     */
+    bool FindBakedWall(FHitResult& OutBestHit, bool& bOutInsideBakedArea);
+
+    /** @brief 焼き込み済みの面から FHitResult を組み立てる */
+    FHitResult MakeBakedHit(const UWallRunSurfaceIndex& Index, int32 SurfaceIndex,
+        const FVector& TraceStart, const FVector& ImpactPoint, float Distance) const;
+
+    /**
+     * @brief 速度から次の検出までの経路を予測し、接触する壁を探す
+     * @return 壁が見つかり、即時検出または接触待ちにした場合 true
+     */
+    bool PredictWallContact();
+
+    /**
+     * @brief 接触待ちの壁の残り時間を進め、接触時刻で検出として確定する
+     * @param DeltaTime 経過時間
+     */
+    void UpdatePendingWall(float DeltaTime);
+
+    /** @brief 接触待ちの壁を破棄 */
+    void ClearPendingWall() { bHasPendingWall = false; PendingTimeToContact = 0.0f; }
+
     /**
      * @brief 実際にレイキャストを実行
      * @param Direction レイの発射方向
@@ -187,6 +308,34 @@ private:
      */
     bool PerformRayCast(const FVector& Direction, FHitResult& OutHit) const;
 
+    /**
+     * @brief 壁検出結果を状態に反映し、必要ならイベントを発行
+     * @param bFoundWall 有効な壁が見つかったか
+     * @param BestHit 見つかった壁のヒット情報
+     */
+    void ApplyDetectionResult(bool bFoundWall, const FHitResult& BestHit);
+
+    /** @brief 壁を見失った状態にしてイベントを発行 */
+    void LoseCurrentWall();
+
+    /** @brief このコンポーネントのトレース優先度（プレイヤー操作中はUrgent） */
+    ETracePriority GetTracePriority() const;
+
+    /** @brief トレースをスケジューラに預けて遅延実行するか */
+    bool ShouldDeferTraces() const;
+
+    /** @brief 方向に対するレイ要求を作成 */
+    FTraceRequest MakeRayRequest(const FVector& Start, const FVector& End) const;
+
+    /** @brief レイのヒット結果から壁走り禁止の面を除外 */
+    bool FilterRayHit(bool bHit, const FHitResult& Hit) const;
+
+    /** @brief 遅延実行した扇状レイの結果を受け取る */
+    void HandleFanTraceCompleted(bool bHit, const FHitResult& Hit, int32 Index);
+
+    /** @brief 遅延実行した壁存在チェックの結果を受け取る */
+    void HandleWallCheckCompleted(bool bHit, const FHitResult& Hit);
+
     /**
      * @brief デバッグ用にレイキャスト可視化を行う
      * @param Direction 発射方向
@@ -218,6 +367,47 @@ private:
     /** 検出タイマー（DetectionInterval の制御用） */
     float DetectionTimer;
 
+    /** スケジューラ（無効なら直接トレース） */
+    TWeakObjectPtr<UTraceSchedulerSubsystem> TraceScheduler;
+
+    /** 面の性質（壁走り禁止など）のキャッシュ */
+    TWeakObjectPtr<UTraversalSurfaceSubsystem> TraversalSurfaces;
+
+    /** 扇状レイの方向数 */
+    static constexpr int32 FanRayCount = 3;
+
+    /** 遅延実行した扇状レイの結果 */
+    FHitResult FanHits[FanRayCount];
+    bool bFanHitValid[FanRayCount] = {};
+
+    /** 結果待ちの扇状レイの数 */
+    int32 PendingFanRays = 0;
+
+    /** スケジューラの結果待ちか（待っている間は再要求しない） */
+    bool bTracePending = false;
+
+    /** ShapeSweep の結果バッファ（容量を使い回す） */
+    TArray<FHitResult> SweepHits;
+
+    /** レベル内の焼き込み済み壁面インデックス（BeginPlayで収集） */
+    UPROPERTY(Transient)
+    TArray<UWallRunSurfaceIndex*> SurfaceIndices;
+
+    /** 現在の壁が焼き込み済みの面なら、そのインデックスと面番号 */
+    UPROPERTY(Transient)
+    UWallRunSurfaceIndex* CurrentSurfaceIndex = nullptr;
+    int32 CurrentSurfaceId = INDEX_NONE;
+
+    /** 焼き込み範囲内では静的ジオメトリを除き、可動物だけをトレースする */
+    bool bTraceDynamicOnly = false;
+
+    /** 速度予測で見つかった、接触待ちの壁 */
+    FHitResult PendingWallHit;
+    bool bHasPendingWall = false;
+
+    /** 接触待ちの壁までの残り時間 */
+    float PendingTimeToContact = 0.0f;
+
     // ============================================================
     // 設定
     // ============================================================
@@ -4,10 +4,12 @@
 #include "Component/WallRun/WallRunComponent.h"
 #include "Component/WallRun/WallDetectionComponent.h"
 #include "Component/WallRun/WallRunLogicComponent.h"
+#include "Component/WallRun/WallRunMovementComponent.h"
 #include "Component/PlayerCameraControlComponent.h"
 #include "Components/TimelineComponent.h"
 #include "Components/BoxComponent.h"
 #include "Components/CapsuleComponent.h"
+#include "TimerManager.h"
 
 #include "Camera/CameraComponent.h"
 
@@ -16,31 +18,13 @@
 
 #include "Interface/PlayerInfoProvider.h"
 
-namespace WallRun
-{
-    // 壁走り関連定数
-    constexpr float WALL_RUN_GRAVITY_SCALE = 0.0f;
-    constexpr float DEFAULT_GRAVITY_SCALE = 5.0f;
-    constexpr float WALL_RUN_SPEED = 5000.0f;
-    constexpr float CAMERA_ROLL_RIGHT = -25.0f;
-    constexpr float CAMERA_ROLL_LEFT = 25.0f;
-
-    // 壁ジャンプ関連定数
-    constexpr float WALL_JUMP_FORWARD_MULTIPLIER = 1.2f;
-    constexpr float WALL_JUMP_UP_MULTIPLIER = 1.0f;
-    constexpr float WALL_JUMP_NORMAL_MULTIPLIER = 0.6f;
-    constexpr float WALL_JUMP_POWER = 4000.0f;
-    constexpr float WALL_JUMP_RESET_DELAY = 0.5f;
-}
-
 UWallRunComponent::UWallRunComponent()
-    : SavedMaxWalkSpeed(600.0f)
-    ,SavedAirControl(0.05f)
-    ,SavedGravityScale(1.0f)
+    : WallRunMovement(nullptr)
     , bAutoBindInput(true)
     , JumpActionName(TEXT("Jump"))
 {
-    PrimaryComponentTick.bCanEverTick = true;
+    // 壁走り中の移動は UWallRunMovementComponent が解くので Tick 不要
+    PrimaryComponentTick.bCanEverTick = false;
 
     // サブコンポーネント生成
     WallDetector = CreateDefaultSubobject<UWallDetectionComponent>(TEXT("WallDetector"));
@@ -59,48 +43,11 @@ void UWallRunComponent::BeginPlay()
     // イベントバインド
     WallDetector->OnWallDetected.AddUObject(this, &UWallRunComponent::HandleWallDetected);
     WallDetector->OnWallLost.AddUObject(this, &UWallRunComponent::HandleWallLost);
+    WallDetector->OnWallPending.AddUObject(this, &UWallRunComponent::HandleWallPending);
 
    
 }
 
-void UWallRunComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-    if (Logic->IsWallRunning())
-    {
-        ACharacter* Character = Cast<ACharacter>(GetOwner());
-        if (!Character)
-            return;
-
-        UCharacterMovementComponent* MoveComp = Character->GetCharacterMovement();
-        if (!MoveComp)
-            return;
-
-        // 移動入力があるかチェック
-        bool bHasMovementInput = !MoveComp->GetLastInputVector().IsNearlyZero();
-
-        // ★ 壁走り開始時の方向を使って壁の存在をチェック
-        FVector CharacterLocation = Character->GetActorLocation();
-
-        // カメラの向きを取得（視線チェック用）
-        UCameraComponent* Camera = PlayerInfoProvider ? PlayerInfoProvider->GetCamera() : nullptr;
-        FVector CameraForward = Camera ? Camera->GetForwardVector() : FVector::ZeroVector;
-
-        // 継続できるか判定
-        if (!Logic->CanContinueWallRun(MoveComp, bHasMovementInput, true))
-        {
-            ExitWallRun();
-            return;
-        }
-
-        // 壁走り中の速度維持
-        UpdateWallRunMovement();
-
-        // デバッグ描画
-        //DrawDebugWallRun();
-    }
-}
 // ======================
 // 初期化
 // ======================
@@ -129,6 +76,16 @@ void UWallRunComponent::InitializeComponent()
         MoveComp->SetPlaneConstraintEnabled(true);
         MoveComp->GravityScale = 5.0f;
     }
+
+    WallRunMovement = Cast<UWallRunMovementComponent>(MoveComp);
+    if (!WallRunMovement)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("WallRunComponent: CharacterMovement is not UWallRunMovementComponent"));
+        return;
+    }
+
+    WallRunMovement->OnWallRunModeEnded.AddUObject(this, &UWallRunComponent::HandleWallRunModeEnded);
+    WallRunMovement->CanContinueWallRunMode.BindUObject(this, &UWallRunComponent::CanContinueWallRunMode);
 }
 
 void UWallRunComponent::ExitWallRun()
@@ -190,6 +147,62 @@ void UWallRunComponent::HandleWallDetected(AActor* Wall, const FHitResult& Hit)
     BeginWallRun(Hit);
 }
 
+// 処理の流れ:
+// 1. 壁走り中、または開始条件を満たしていなければ何もしない
+// 2. 予測した壁の法線から壁走りデータを求め、カメラのロールだけ先に壁側へ寄せる
+//    （ロールは補間されるので、接触時点で傾ききっていない状態を減らせる）
+// 3. 接触予定時刻を過ぎても壁走りが始まらなければ、先行した補正を戻す
+void UWallRunComponent::HandleWallPending(AActor* Wall, const FHitResult& Hit, float TimeToContact)
+{
+    if (Logic->IsWallRunning() || !WallRunMovement || !PlayerInfoProvider)
+        return;
+
+    const bool bHasMovementInput = !WallRunMovement->GetLastInputVector().IsNearlyZero();
+    if (!Logic->CanStartWallRun(WallRunMovement, bHasMovementInput))
+        return;
+
+    UCameraComponent* Camera = PlayerInfoProvider->GetCamera();
+    ACharacter* Character = Cast<ACharacter>(GetOwner());
+    if (!Camera || !Character)
+        return;
+
+    const FWallRunData Data = Logic->CalculateWallRunData(
+        Hit.ImpactNormal,
+        Camera->GetForwardVector(),
+        Character->GetActorUpVector()
+    );
+    ApplyWallRunCamera(Data);
+    bWallRunPreArmed = true;
+
+    // 接触フレームの確認に1検出間隔ぶんの猶予を持たせる
+    if (UWorld* World = GetWorld())
+    {
+        const float Timeout = TimeToContact + WallDetector->GetSettings().DetectionInterval;
+        World->GetTimerManager().SetTimer(PreArmTimerHandle, this, &UWallRunComponent::CancelPreArm, Timeout, false);
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("WallRun: Pre-armed for %s in %.3fs"), *GetNameSafe(Wall), TimeToContact);
+}
+
+void UWallRunComponent::CancelPreArm()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(PreArmTimerHandle);
+    }
+
+    if (!bWallRunPreArmed)
+        return;
+
+    bWallRunPreArmed = false;
+
+    // 壁走りが始まっていればロールはそのまま使う
+    if (!Logic->IsWallRunning())
+    {
+        ResetCamera();
+    }
+}
+
 void UWallRunComponent::HandleWallLost(AActor* Wall)
 {
     if (Logic->IsWallRunning())
@@ -202,6 +215,29 @@ void UWallRunComponent::HandleWallLost(AActor* Wall)
     }
 }
 
+void UWallRunComponent::HandleWallRunModeEnded()
+{
+    if (Logic->IsWallRunning())
+    {
+        UE_LOG(LogTemp, Log, TEXT("WallRun: Movement mode ended - Ending WallRun"));
+
+        ExitWallRun();
+    }
+}
+
+bool UWallRunComponent::CanContinueWallRunMode(bool bWallStillAdjacent) const
+{
+    if (!WallRunMovement)
+    {
+        return false;
+    }
+
+    // 移動入力があるかチェック
+    const bool bHasMovementInput = !WallRunMovement->GetLastInputVector().IsNearlyZero();
+
+    return Logic->CanContinueWallRun(WallRunMovement, bHasMovementInput, bWallStillAdjacent);
+}
+
 bool UWallRunComponent::HandleJumpPressed()
 {
     // 壁ジャンプ可能なら実行
@@ -249,6 +285,9 @@ void UWallRunComponent::BeginWallRun(const FHitResult& WallHit)
 
     Logic->EnterWallRun(Data, CurrentGravity);
 
+    // 予測による先行補正はここで引き継ぐ
+    CancelPreArm();
+
 
     FVector WallDirection;
     // ★ 壁方向を保存（壁の法線の逆方向 = 壁に向かう方向）
@@ -265,53 +304,6 @@ void UWallRunComponent::BeginWallRun(const FHitResult& WallHit)
         *WallHit.ImpactNormal.ToString(), *Data.MoveDirection.ToString());
 }
 
-void UWallRunComponent::UpdateWallRunMovement()
-{
-    if (!Logic->IsWallRunning())
-        return;
-
-    ACharacter* Character = Cast<ACharacter>(GetOwner());
-    if (!Character)
-        return;
-
-    UCharacterMovementComponent* MoveComp = Character->GetCharacterMovement();
-    if (!MoveComp)
-        return;
-
-    // ✅ 壁走り方向を取得
-    FVector MoveDir = Logic->GetMoveDirection();
-
-    // 正規化して確認
-    if (MoveDir.IsNearlyZero())
-    {
-        UE_LOG(LogTemp, Error, TEXT("WallRun: Move direction is zero!"));
-        return;
-    }
-
-    MoveDir.Normalize();
-
-    // Gravityを0に固定
-    if (MoveComp->GravityScale != 0.0f)
-    {
-        MoveComp->GravityScale = 0.0f;
-    }
-
-    // 垂直方向の速度を0に保つ
-    FVector CurrentVel = MoveComp->Velocity;
-    CurrentVel.Z = 0.0f;
-
-    // ✅ 直接速度を設定
-    const FWallRunSettings& Settings = Logic->GetSettings();
-    FVector NewVelocity = MoveDir * Settings.Speed;
-    NewVelocity.Z = 0.0f;  // 念のため
-
-    MoveComp->Velocity = NewVelocity;
-
-    UE_LOG(LogTemp, Verbose, TEXT("WallRun: Dir=%s, Vel=%s, Speed=%.2f"),
-        *MoveDir.ToString(), *MoveComp->Velocity.ToString(), MoveComp->Velocity.Size2D());
-}
-
-
 void UWallRunComponent::ExecuteWallJump()
 {
     if (!PlayerInfoProvider)
@@ -344,37 +336,15 @@ void UWallRunComponent::ExecuteWallJump()
 
 void UWallRunComponent::ApplyWallRunMovement(const FWallRunData& Data)
 {
-    if (!PlayerInfoProvider)
-        return;
-
-    ACharacter* Character = Cast<ACharacter>(GetOwner());
-    if (!Character)
-        return;
-
-    UCharacterMovementComponent* MoveComp = Character->GetCharacterMovement();
-    if (!MoveComp)
+    if (!WallRunMovement)
         return;
 
     const FWallRunSettings& Settings = Logic->GetSettings();
 
-    // 元の設定を保存
-    SavedMaxWalkSpeed = MoveComp->MaxWalkSpeed;
-    SavedAirControl = MoveComp->AirControl;
-    SavedGravityScale = MoveComp->GravityScale;
-
-    // 壁走り用設定を適用
-    MoveComp->MaxWalkSpeed = Settings.Speed;
-    MoveComp->AirControl = 1.0f;
-    MoveComp->GravityScale = Settings.GravityScale;
+    // 壁走りモードへ移行（速度・重力は移動モード側で解く）
+    WallRunMovement->BeginWallRun(Data.MoveDirection, Data.WallNormal, Settings.Speed);
 
-    FVector CurrentVelocity = MoveComp->Velocity;
-
-    // 壁走り方向の速度のみを設定（垂直方向はゼロに）
-    FVector NewVelocity = Data.MoveDirection * WallRun::WALL_RUN_SPEED;
-    NewVelocity.Z = 0.0f;  // 垂直方向の速度をゼロに
-
-    UE_LOG(LogTemp, Warning, TEXT("WallRun Applied: Speed=%f, AirControl=%f, Gravity=%f"),
-        MoveComp->MaxWalkSpeed, MoveComp->AirControl, MoveComp->GravityScale);
+    UE_LOG(LogTemp, Warning, TEXT("WallRun Applied: Speed=%f"), Settings.Speed);
 }
 
 void UWallRunComponent::ApplyWallRunCamera(const FWallRunData& Data)
@@ -397,27 +367,16 @@ void UWallRunComponent::ApplyWallRunCamera(const FWallRunData& Data)
 
 void UWallRunComponent::ResetMovement()
 {
-    if (!PlayerInfoProvider)
-        return;
-
-    ACharacter* Character = Cast<ACharacter>(GetOwner());
-    if (!Character)
-        return;
-
-    UCharacterMovementComponent* MoveComp = Character->GetCharacterMovement();
-    if (!MoveComp)
+    if (!WallRunMovement)
         return;
 
-    // 保存していた設定を復元
-    MoveComp->MaxWalkSpeed = SavedMaxWalkSpeed;
-    MoveComp->AirControl = SavedAirControl;
-    MoveComp->GravityScale = SavedGravityScale;
+    // 壁走りモード中なら落下へ戻す
+    WallRunMovement->EndWallRun();
 
     // 平面拘束をクリア
-    MoveComp->SetPlaneConstraintNormal(FVector::ZeroVector);
+    WallRunMovement->SetPlaneConstraintNormal(FVector::ZeroVector);
 
-    UE_LOG(LogTemp, Warning, TEXT("WallRun Reset: Speed=%f, AirControl=%f, Gravity=%f"),
-        MoveComp->MaxWalkSpeed, MoveComp->AirControl, MoveComp->GravityScale);
+    UE_LOG(LogTemp, Warning, TEXT("WallRun Reset"));
 }
 
 void UWallRunComponent::ResetCamera()
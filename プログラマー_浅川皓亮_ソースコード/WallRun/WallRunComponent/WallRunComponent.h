@@ -10,6 +10,7 @@ class UCameraComponent;
 class IPlayerInfoProvider;
 class UWallDetectionComponent;
 class UWallRunLogicComponent;
+class UWallRunMovementComponent;
 struct FWallRunData;
 struct  FTimeline;
 
@@ -19,11 +20,13 @@ struct  FTimeline;
  * @brief 壁走り（WallRun）を管理するコンポーネント
  *
  * キャラクターが壁を検出してから壁走りを開始・維持・終了するまでの全体制御を行う。
- * 壁走り中は、速度・重力・カメラの挙動を補正し、滑らかな移動体験を提供する。
+ * 壁走り中の移動は UWallRunMovementComponent の独自移動モードで解き、
+ * このコンポーネントは開始・終了の判断とカメラ補正を担当する。
  *
  * 依存関係:
  * - UWallDetectionComponent : 壁の検出
  * - UWallRunLogicComponent   : 壁走り中の移動・姿勢ロジック
+ * - UWallRunMovementComponent : 壁走りモードの移動解決（キャラクターの移動コンポーネント）
  * - IPlayerInfoProvider      : キャラクター情報アクセス（MovementComponentなど）
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
@@ -77,9 +80,6 @@ protected:
 
     /** ゲーム開始時に初期化処理を行う */
     virtual void BeginPlay() override;
-
-    /** フレームごとに更新処理を行う */
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 private:
     // ============================================================
     // 内部処理関数群
@@ -113,6 +113,32 @@ private:
      */
     void HandleWallLost(AActor* Wall);
 
+    /**
+     * @brief 予測で壁への接触が見込まれたときの処理
+     * @details 開始条件を満たしていれば、接触前からカメラのロールを壁側へ寄せておく
+     * @param Wall 接触が見込まれる壁アクター
+     * @param Hit 予測した壁とのヒット情報
+     * @param TimeToContact 接触までの時間（秒）
+     */
+    void HandleWallPending(AActor* Wall, const FHitResult& Hit, float TimeToContact);
+
+    /**
+     * @brief 予測した接触が起きなかったときに、先行したカメラ補正を戻す
+     */
+    void CancelPreArm();
+
+    /**
+     * @brief 移動コンポーネント側で壁走りモードが終了したときの処理
+     * @details 着地・正面衝突・壁から離れた場合など
+     */
+    void HandleWallRunModeEnded();
+
+    /**
+     * @brief 壁走りモードを継続できるか（移動コンポーネントから毎ステップ呼ばれる）
+     * @param bWallStillAdjacent 壁がまだ横にあるか
+     */
+    bool CanContinueWallRunMode(bool bWallStillAdjacent) const;
+
 
     // ============================================================
     // 壁走り挙動制御
@@ -124,12 +150,6 @@ private:
      */
     void BeginWallRun(const FHitResult& WallHit);
 
-    /**
-     * @brief 壁走り中の移動更新処理
-     * @details 毎フレーム呼ばれ、キャラクターの速度・重力・方向を補正
-     */
-    void UpdateWallRunMovement();
-
     /**
      * @brief 壁走り中のジャンプを実行
      * @details 壁の法線方向へ跳ねる処理。通常のジャンプと差別化される。
@@ -181,6 +201,16 @@ private:
     UPROPERTY()
     TScriptInterface<IPlayerInfoProvider> PlayerInfoProvider;
 
+    /** 壁走りモードを持つ移動コンポーネント */
+    UPROPERTY()
+    UWallRunMovementComponent* WallRunMovement;
+
+    /** 予測した接触の期限（過ぎても壁走りが始まらなければ先行補正を戻す） */
+    FTimerHandle PreArmTimerHandle;
+
+    /** 予測による先行補正中か */
+    bool bWallRunPreArmed = false;
+
 
     // ============================================================
     // 入力設定
@@ -195,16 +225,4 @@ private:
     bool bAutoBindInput;
 
 
-    // ============================================================
-    // 内部状態キャッシュ
-    // ============================================================
-
-    /** 壁走り前に保存する歩行速度（復元用） */
-    float SavedMaxWalkSpeed;
-
-    /** 壁走り前に保存する空中制御値 */
-    float SavedAirControl;
-
-    /** 壁走り前に保存する重力スケール */
-    float SavedGravityScale;
 };
\ No newline at end of file